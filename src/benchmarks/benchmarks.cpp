@@ -2,12 +2,18 @@
 
 #include <rpp/rpp.hpp>
 
+#include <atomic>
+#include <cstdlib>
+#include <deque>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <map>
+#include <new>
 #include <span>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #ifdef RPP_BUILD_RXCPP
     #include <rxcpp/rx.hpp>
@@ -42,6 +48,105 @@ char const * json() noexcept
 ])DELIM";
 }
 
+namespace
+{
+    std::atomic_bool   s_count_allocations{};
+    std::atomic_size_t s_allocations_count{};
+    std::atomic_size_t s_deallocations_count{};
+
+    template<typename Fn>
+    void report_allocations(std::string_view name, Fn&& fn)
+    {
+        constexpr size_t iterations = 1'000;
+        // warm-up to reach steady state
+        fn();
+
+        s_allocations_count.store(0);
+        s_count_allocations.store(true);
+        for (size_t i = 0; i < iterations; ++i)
+            fn();
+        s_count_allocations.store(false);
+
+        std::cerr << name << ": " << static_cast<double>(s_allocations_count.load()) / iterations << " allocations per operation" << std::endl;
+    }
+
+    template<typename Fn>
+    void report_live_allocations(std::string_view name, Fn&& fn)
+    {
+        // warm-up to reach steady state
+        fn();
+
+        s_allocations_count.store(0);
+        s_deallocations_count.store(0);
+        s_count_allocations.store(true);
+        fn();
+        s_count_allocations.store(false);
+
+        std::cerr << name << ": " << static_cast<int64_t>(s_allocations_count.load() - s_deallocations_count.load()) << " allocations still alive after operation" << std::endl;
+    }
+
+    void count_allocation()
+    {
+        if (s_count_allocations.load(std::memory_order::relaxed))
+            s_allocations_count.fetch_add(1, std::memory_order::relaxed);
+    }
+
+    void count_deallocation()
+    {
+        if (s_count_allocations.load(std::memory_order::relaxed))
+            s_deallocations_count.fetch_add(1, std::memory_order::relaxed);
+    }
+}
+
+void* operator new(size_t size)
+{
+    count_allocation();
+
+    if (void* ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+// used by rpp::utils::ring_buffer (and so, delay/observe_on/merge/replay_subject)
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    count_allocation();
+
+    const auto align = static_cast<size_t>(alignment);
+    // aligned_alloc expects size to be multiple of alignment
+    if (void* ptr = std::aligned_alloc(align, (size + align - 1) / align * align))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (ptr)
+        count_deallocation();
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    if (ptr)
+        count_deallocation();
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    if (ptr)
+        count_deallocation();
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept
+{
+    if (ptr)
+        count_deallocation();
+    std::free(ptr);
+}
+
 std::optional<std::string_view> find_argument(std::string_view target_argument, std::span<char*> args)
 {
     for (const auto raw_argument : args)
@@ -118,6 +223,19 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int) {});
             });
         }
+
+        SECTION("immediate_just(1) + as_dynamic() + subscribe")
+        {
+            const auto fn = [&]() {
+                rpp::immediate_just(1).as_dynamic().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            };
+
+            report_allocations("immediate_just(1) + as_dynamic() + subscribe", fn);
+            TEST_RPP(fn);
+            TEST_RXCPP([&]() {
+                rxcpp::immediate_just(1).as_dynamic().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
     };
 
     BENCHMARK("Sources")
@@ -148,9 +266,12 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
 
         SECTION("concat_as_source of just(1 immediate) create + subscribe")
         {
-            TEST_RPP([&]() {
+            const auto fn = [&]() {
                 rpp::source::concat(rpp::source::just(rpp::schedulers::immediate{}, 1)).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
-            });
+            };
+
+            report_allocations("concat_as_source of just(1 immediate) create + subscribe", fn);
+            TEST_RPP(fn);
 
             TEST_RXCPP([&]() {
                 rxcpp::observable<>::just(rxcpp::observable<>::just(1, rxcpp::identity_immediate()), rxcpp::identity_immediate()) | rxcpp::operators::concat() | rxcpp::operators::subscribe<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
@@ -241,6 +362,326 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     });
                 });
         }
+
+        const auto test_schedulables_queue = [&](size_t pending) {
+            rpp::schedulers::details::schedulables_queue<rpp::schedulers::new_thread::worker_strategy> queue{};
+            const auto schedulable = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+            const auto get_timepoint = [pending](size_t i) { return rpp::schedulers::time_point{std::chrono::nanoseconds{(i * 7919) % pending}}; };
+
+            size_t index{};
+            for (; index < pending; ++index)
+                queue.emplace(get_timepoint(index), schedulable, rpp::make_lambda_observer([](int) {}));
+
+            TEST_RPP([&]() {
+                queue.emplace(get_timepoint(index++), schedulable, rpp::make_lambda_observer([](int) {}));
+                ankerl::nanobench::doNotOptimizeAway(queue.pop());
+            });
+        };
+
+        SECTION("schedulables_queue emplace + pop with 10 pending schedulables")
+        {
+            test_schedulables_queue(10);
+        }
+
+        SECTION("schedulables_queue emplace + pop with 1000 pending schedulables")
+        {
+            test_schedulables_queue(1'000);
+        }
+
+        SECTION("schedulables_queue emplace + pop with 100000 pending schedulables")
+        {
+            test_schedulables_queue(100'000);
+        }
+
+        const auto test_armed_timers = [&](const std::optional<rpp::schedulers::timing_wheel>& wheel) {
+            constexpr size_t armed = 1'000'000;
+
+            rpp::schedulers::details::schedulables_pool pool{};
+            rpp::schedulers::details::schedulables_queue<rpp::schedulers::new_thread::worker_strategy> queue{pool, wheel};
+            const auto schedulable   = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+            const auto now           = rpp::schedulers::new_thread::worker_strategy::now();
+            const auto get_timepoint = [now](size_t i) { return now + std::chrono::microseconds{(i * 7919) % 10'000'000}; };
+
+            size_t index{};
+            for (; index < armed; ++index)
+                queue.emplace(get_timepoint(index), schedulable, rpp::make_lambda_observer([](int) {}));
+
+            TEST_RPP([&]() {
+                queue.emplace(get_timepoint(index++), schedulable, rpp::make_lambda_observer([](int) {}));
+                ankerl::nanobench::doNotOptimizeAway(queue.pop());
+            });
+        };
+
+        SECTION("1M armed timers: schedulables_queue emplace + pop via binary heap")
+        {
+            test_armed_timers(std::nullopt);
+        }
+
+        SECTION("1M armed timers: schedulables_queue emplace + pop via timing_wheel(1ms)")
+        {
+            test_armed_timers(rpp::schedulers::timing_wheel{std::chrono::milliseconds{1}});
+        }
+
+        SECTION("run_loop scheduler schedule + dispatch")
+        {
+            rpp::schedulers::run_loop run_loop{};
+            const auto                worker = run_loop.create_worker();
+            const auto                observer = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            const auto                fn       = [&]() {
+                worker.schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_delay_from_now{}; }, observer);
+                run_loop.dispatch();
+            };
+
+            report_allocations("run_loop scheduler schedule + dispatch", fn);
+            TEST_RPP(fn);
+        }
+
+        SECTION("publish_subject + observe_on(run_loop) on_next + dispatch")
+        {
+            rpp::schedulers::run_loop           run_loop{};
+            rpp::subjects::publish_subject<int> subj{};
+            subj.get_observable() | rpp::operators::observe_on(run_loop) | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+            const auto fn = [&]() {
+                subj.get_observer().on_next(1);
+                run_loop.dispatch();
+            };
+
+            report_allocations("publish_subject + observe_on(run_loop) on_next + dispatch", fn);
+            TEST_RPP(fn);
+        }
+
+        SECTION("publish_subject + observe_on(run_loop) 100 on_next + dispatch")
+        {
+            rpp::schedulers::run_loop           run_loop{};
+            rpp::subjects::publish_subject<int> subj{};
+            subj.get_observable() | rpp::operators::observe_on(run_loop) | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+            const auto fn = [&]() {
+                for (int i = 0; i < 100; ++i)
+                    subj.get_observer().on_next(i);
+                run_loop.dispatch();
+            };
+
+            report_allocations("publish_subject + observe_on(run_loop) 100 on_next + dispatch", fn);
+            TEST_RPP(fn);
+        }
+
+        SECTION("publish_subject + observe_on(run_loop, 16, drop_oldest) on_next + dispatch")
+        {
+            rpp::schedulers::run_loop           run_loop{};
+            rpp::subjects::publish_subject<int> subj{};
+            subj.get_observable() | rpp::operators::observe_on(run_loop, 16, rpp::operators::overflow_policy::drop_oldest) | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+            const auto fn = [&]() {
+                subj.get_observer().on_next(1);
+                run_loop.dispatch();
+            };
+
+            report_allocations("publish_subject + observe_on(run_loop, 16, drop_oldest) on_next + dispatch", fn);
+            TEST_RPP(fn);
+        }
+
+        const auto test_concurrent_subscriptions = [&](const auto& scheduler) {
+            TEST_RPP([&]() {
+                constexpr size_t  count = 1'000;
+                std::atomic_size_t completed{};
+                for (size_t i = 0; i < count; ++i)
+                {
+                    rpp::source::just(rpp::schedulers::immediate{}, 1)
+                        | rpp::operators::subscribe_on(scheduler)
+                        | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }, [&completed] { ++completed; });
+                }
+                while (completed.load() != count)
+                    std::this_thread::yield();
+            });
+        };
+
+        SECTION("1000 subscriptions via subscribe_on(new_thread)")
+        {
+            test_concurrent_subscriptions(rpp::schedulers::new_thread{});
+        }
+
+        SECTION("1000 subscriptions via subscribe_on(thread_pool)")
+        {
+            test_concurrent_subscriptions(rpp::schedulers::thread_pool{});
+        }
+
+        SECTION("1000 subscriptions via subscribe_on(event_loop)")
+        {
+            test_concurrent_subscriptions(rpp::schedulers::event_loop{});
+        }
+
+        SECTION("1000 delay(1h) subscriptions via event_loop: subscribe + dispose")
+        {
+            rpp::schedulers::event_loop loop{1};
+            // alive timer of another subscription in front of disposed ones: they are not on the top of the queue
+            const auto alive_worker = loop.create_worker();
+            alive_worker.schedule(std::chrono::minutes{30}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
+
+            const auto fn = [&]() {
+                std::vector<rpp::composite_disposable_wrapper> disposables{};
+                disposables.reserve(1'000);
+                for (size_t i = 0; i < 1'000; ++i)
+                {
+                    disposables.push_back(rpp::source::just(rpp::schedulers::immediate{}, 1)
+                                          | rpp::operators::delay(std::chrono::hours{1}, loop)
+                                          | rpp::operators::subscribe(rpp::composite_disposable_wrapper{std::make_shared<rpp::composite_disposable>()}, [](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+                }
+                for (const auto& d : disposables)
+                    d.dispose();
+
+                // wait till thread of loop processes all disposals
+                std::promise<void> processed{};
+                loop.create_worker().schedule([&processed](const auto&) { processed.set_value(); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
+                processed.get_future().wait();
+            };
+
+            report_live_allocations("1000 delay(1h) subscriptions via event_loop: subscribe + dispose", fn);
+            TEST_RPP(fn);
+        }
+
+        SECTION("now() via clocks::steady")
+        {
+            TEST_RPP([&]() { ankerl::nanobench::doNotOptimizeAway(rpp::schedulers::clocks::steady::now()); });
+        }
+
+        SECTION("now() via clocks::tsc")
+        {
+            TEST_RPP([&]() { ankerl::nanobench::doNotOptimizeAway(rpp::schedulers::clocks::tsc::now()); });
+        }
+
+        SECTION("now() via clocks::cached inside of batch")
+        {
+            const rpp::schedulers::clocks::cached<>::batch_scope scope{};
+            TEST_RPP([&]() { ankerl::nanobench::doNotOptimizeAway(rpp::schedulers::clocks::cached<>::now()); });
+        }
+
+        SECTION("1h of interval(1s) + delay(1s) replayed via virtual_time")
+        {
+            TEST_RPP([&]() {
+                rpp::schedulers::virtual_time scheduler{};
+                rpp::source::interval(std::chrono::seconds{1}, scheduler)
+                    | rpp::operators::delay(std::chrono::seconds{1}, scheduler)
+                    | rpp::operators::subscribe([](size_t v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                scheduler.advance_by(std::chrono::hours{1});
+            });
+        }
+
+        SECTION("4 producers x 1000 schedules into one new_thread worker")
+        {
+            const auto worker   = rpp::schedulers::new_thread::create_worker();
+            const auto observer = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            TEST_RPP([&]() {
+                constexpr size_t producers_count = 4;
+                constexpr size_t count           = 1'000;
+
+                std::atomic_size_t executed{};
+                std::vector<std::thread> producers{};
+                for (size_t i = 0; i < producers_count; ++i)
+                {
+                    producers.emplace_back([&] {
+                        for (size_t j = 0; j < count; ++j)
+                            worker.schedule([&executed](const auto&) { ++executed; return rpp::schedulers::optional_delay_from_now{}; }, observer);
+                    });
+                }
+                for (auto& t : producers)
+                    t.join();
+                while (executed.load() != producers_count * count)
+                    std::this_thread::yield();
+            });
+        }
+    }
+
+    BENCHMARK("Disposables")
+    {
+        SECTION("refcount_disposable add_ref + dispose")
+        {
+            const auto refcount = std::make_shared<rpp::refcount_disposable>();
+            const auto keep     = refcount->add_ref();
+
+            const auto fn = [&]() {
+                refcount->add_ref().dispose();
+            };
+
+            report_allocations("refcount_disposable add_ref + dispose", fn);
+            TEST_RPP(fn);
+        }
+
+        SECTION("disposable_wrapper is_disposed")
+        {
+            const auto d = rpp::disposable_wrapper::from_shared(std::make_shared<rpp::composite_disposable>());
+
+            report_allocations("disposable_wrapper is_disposed", [&] { ankerl::nanobench::doNotOptimizeAway(d.is_disposed()); });
+            TEST_RPP([&]() {
+                ankerl::nanobench::doNotOptimizeAway(d.is_disposed());
+            });
+        }
+
+        SECTION("disposable_wrapper(weak) is_disposed")
+        {
+            const auto original = std::make_shared<rpp::composite_disposable>();
+            const auto d        = rpp::disposable_wrapper::from_weak(original);
+
+            TEST_RPP([&]() {
+                ankerl::nanobench::doNotOptimizeAway(d.is_disposed());
+            });
+        }
+
+        SECTION("composite_disposable add + remove + is_disposed")
+        {
+            const auto composite = std::make_shared<rpp::composite_disposable>();
+            const auto other     = rpp::disposable_wrapper::from_shared(std::make_shared<rpp::composite_disposable>());
+
+            TEST_RPP([&]() {
+                composite->add(other);
+                composite->remove(other);
+                ankerl::nanobench::doNotOptimizeAway(composite->is_disposed());
+            });
+        }
+
+        SECTION("non_atomic_composite_disposable add + remove + is_disposed")
+        {
+            const auto composite = std::make_shared<rpp::non_atomic_composite_disposable>();
+            const auto other     = rpp::disposable_wrapper::from_shared(std::make_shared<rpp::non_atomic_composite_disposable>());
+
+            TEST_RPP([&]() {
+                composite->add(other);
+                composite->remove(other);
+                ankerl::nanobench::doNotOptimizeAway(composite->is_disposed());
+            });
+        }
+
+        SECTION("composite_disposable with 1000 disposables add + remove")
+        {
+            const auto composite = std::make_shared<rpp::composite_disposable>();
+            for (size_t i = 0; i < 1000; ++i)
+                composite->add(rpp::disposable_wrapper::from_shared(std::make_shared<rpp::composite_disposable>()));
+
+            const auto other = rpp::disposable_wrapper::from_shared(std::make_shared<rpp::composite_disposable>());
+            const auto fn    = [&]() {
+                composite->add(other);
+                composite->remove(other);
+            };
+
+            report_allocations("composite_disposable with 1000 disposables add + remove", fn);
+            TEST_RPP(fn);
+        }
+
+        SECTION("composite_disposable with 1000 disposables insert + erase")
+        {
+            const auto composite = std::make_shared<rpp::composite_disposable_impl<rpp::details::disposables::slot_map_disposables_container>>();
+            for (size_t i = 0; i < 1000; ++i)
+                composite->add(rpp::disposable_wrapper::from_shared(std::make_shared<rpp::composite_disposable>()));
+
+            const auto other = rpp::disposable_wrapper::from_shared(std::make_shared<rpp::composite_disposable>());
+            const auto fn    = [&]() {
+                composite->erase(composite->insert(other).value());
+            };
+
+            report_allocations("composite_disposable with 1000 disposables insert + erase", fn);
+            TEST_RPP(fn);
+        }
     }
 
     BENCHMARK("Combining Operators")
@@ -266,11 +707,14 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
 
         SECTION("immediate_just(1) + merge_with(immediate_just(2)) + subscribe")
         {
-            TEST_RPP([&]() {
+            const auto fn = [&]() {
                 rpp::immediate_just(1)
                     | rpp::operators::merge_with(rpp::immediate_just(2))
                     | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
-            });
+            };
+
+            report_allocations("immediate_just(1) + merge_with(immediate_just(2)) + subscribe", fn);
+            TEST_RPP(fn);
 
             TEST_RXCPP([&]() {
                 rxcpp::immediate_just(1)
@@ -279,6 +723,25 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
             });
         }
 
+        SECTION("4 producers x 1000 on_next into merge_with of 4 subjects")
+        {
+            std::vector<rpp::subjects::publish_subject<int>> subjects(4);
+            subjects[0].get_observable()
+                | rpp::operators::merge_with(subjects[1].get_observable(), subjects[2].get_observable(), subjects[3].get_observable())
+                | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+            TEST_RPP([&]() {
+                std::vector<std::thread> threads{};
+                for (const auto& subj : subjects)
+                    threads.emplace_back([&subj] {
+                        for (int v = 0; v < 1'000; ++v)
+                            subj.get_observer().on_next(v);
+                    });
+                for (auto& t : threads)
+                    t.join();
+            });
+        }
+
         SECTION("immediate_just(1) + with_latest_from(immediate_just(2)) + subscribe")
         {
             TEST_RPP([&]() {
@@ -343,6 +806,22 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+
+        SECTION("publish_subject+take_until(publish_subject)+subscribe")
+        {
+            rpp::subjects::publish_subject<int> source{};
+            rpp::subjects::publish_subject<int> other{};
+
+            const auto fn = [&]() {
+                source.get_observable()
+                    | rpp::operators::take_until(other.get_observable())
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                other.get_observer().on_next(1);
+            };
+
+            report_allocations("publish_subject+take_until(publish_subject)+subscribe", fn);
+            TEST_RPP(fn);
+        }
     };
 
     BENCHMARK("Transforming Operators")
@@ -392,6 +871,21 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
             });
         }
 
+        SECTION("immediate_just+concat_map(immediate_just(v*2))+subscribe")
+        {
+            TEST_RPP([&]() {
+                rpp::immediate_just(1)
+                    | rpp::operators::concat_map([](int v) { return rpp::immediate_just(v * 2); })
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+
+            TEST_RXCPP([&]() {
+                rxcpp::immediate_just(1)
+                    | rxcpp::operators::concat_map([](int v) { return rxcpp::immediate_just(v * 2); })
+                    | rxcpp::operators::subscribe<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
         SECTION("immediate_just+buffer(2)+subscribe")
         {
             TEST_RPP([&]() {
@@ -585,6 +1079,87 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                 });
             }
         }
+
+        SECTION("serialized_subject with 1 observer - on_next")
+        {
+            rpp::subjects::serialized_subject<int> subj{};
+            subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+
+            TEST_RPP([&]() {
+                subj.get_observer().on_next(1);
+            });
+        }
+
+        SECTION("single_threaded_subject with 1 observer - on_next")
+        {
+            rpp::subjects::single_threaded_subject<int> subj{};
+            subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+
+            TEST_RPP([&]() {
+                subj.get_observer().on_next(1);
+            });
+        }
+
+        SECTION("single_threaded_subject - subscribe + dispose observer")
+        {
+            rpp::subjects::single_threaded_subject<int> subj{};
+            subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+
+            TEST_RPP([&]() {
+                const auto d = std::make_shared<rpp::non_atomic_composite_disposable>();
+                subj.get_observable().subscribe(rpp::composite_disposable_wrapper{d}, [](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                d->dispose();
+            });
+        }
+
+        SECTION("publish_subject with 1000 observers - on_next")
+        {
+            rpp::subjects::publish_subject<int> subj{};
+            for (size_t i = 0; i < 1'000; ++i)
+                subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+
+            TEST_RPP([&]() {
+                subj.get_observer().on_next(1);
+            });
+        }
+
+        SECTION("publish_subject with 1000 observers - churn: subscribe + dispose one observer")
+        {
+            rpp::subjects::publish_subject<int>           subj{};
+            std::deque<rpp::composite_disposable_wrapper> disposables{};
+            const auto                                    subscribe = [&]() {
+                disposables.push_back(subj.get_observable().subscribe_with_disposable([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+            };
+            for (size_t i = 0; i < 1'000; ++i)
+                subscribe();
+
+            TEST_RPP([&]() {
+                subscribe();
+                disposables.front().dispose();
+                disposables.pop_front();
+            });
+        }
+
+        SECTION("single_threaded_subject with 1000 observers - on_next")
+        {
+            rpp::subjects::single_threaded_subject<int> subj{};
+            for (size_t i = 0; i < 1'000; ++i)
+                subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+
+            TEST_RPP([&]() {
+                subj.get_observer().on_next(1);
+            });
+        }
+
+        SECTION("replay_subject(100) with 1 observer - on_next")
+        {
+            rpp::subjects::replay_subject<int> subj{size_t{100}};
+            subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+
+            TEST_RPP([&]() {
+                subj.get_observer().on_next(1);
+            });
+        }
     }
 
     BENCHMARK("Scenarios")
@@ -49,5 +49,23 @@ int main() // NOLINT(bugprone-exception-escape)
     // emit error in thread{139800298538880} duration since start 3s
     // observe error in thread{139800298538880} duration since start 3s
     //! [observe_on]
+
+    //! [bounded_observe_on]
+    const auto bounded = rpp::operators::observe_on(rpp::schedulers::new_thread{}, 2, rpp::operators::overflow_policy::drop_oldest);
+
+    rpp::source::just(1, 2, 3, 4, 5)
+        | bounded
+        | rpp::operators::as_blocking()
+        | rpp::operators::subscribe([](int v)
+                                    {
+                                        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+                                        std::cout << v << " ";
+                                    });
+    std::cout << std::endl << "dropped " << bounded.get_dropped_count() << std::endl;
+
+    // Possible output (depends on timings):
+    // 4 5
+    // dropped 3
+    //! [bounded_observe_on]
     return 0;
 }
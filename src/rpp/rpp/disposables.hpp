@@ -23,4 +23,5 @@
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/disposables/interface_disposable.hpp>
+#include <rpp/disposables/interface_requestable_disposable.hpp>
 #include <rpp/disposables/refcount_disposable.hpp>
@@ -18,11 +18,13 @@ namespace rpp
 {
 /**
  * @brief Disposable invokes underlying callable on disposing.
- * 
+ *
+ * @details `Mode` selects if disposable could be disposed from multiple threads at the same time (default) or from one thread only.
+ *
  * @ingroup disposables
  */
-template<rpp::constraint::is_nothrow_invocable Fn>
-class callback_disposable final : public details::base_disposable
+template<rpp::constraint::is_nothrow_invocable Fn, details::disposables::AtomicMode Mode>
+class callback_disposable final : public details::base_disposable_impl<interface_disposable, Mode>
 {
 public:
     explicit callback_disposable(Fn&& fn)
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <rpp/disposables/fwd.hpp>
+#include <rpp/disposables/details/atomic.hpp>
 #include <rpp/disposables/details/container.hpp>
 
 #include <rpp/disposables/disposable_wrapper.hpp>
@@ -18,6 +19,7 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace rpp
@@ -25,9 +27,11 @@ namespace rpp
 /**
  * @brief Disposable which can keep some other sub-disposables. When this root disposable is disposed, then all sub-disposables would be disposed too.
  *
+ * @details `Mode` selects how internal state is guarded: `AtomicMode::Atomic` allows usage from any thread, `AtomicMode::NonAtomic` replaces atomic read-modify-write operations with plain ones and must be used only when disposable is never accessed from multiple threads.
+ *
  * @ingroup disposables
  */
-template<details::disposables::constraint::disposable_container Container>
+template<details::disposables::constraint::disposable_container Container, details::disposables::AtomicMode Mode>
 class composite_disposable_impl : public interface_composite_disposable
 {
 public:
@@ -65,7 +69,7 @@ public:
 
     void add(disposable_wrapper disposable) override
     {
-        if (disposable.is_disposed() || disposable.get_original().get() == this)
+        if (disposable.is_disposed_or_same_as(this))
             return;
 
         while (true)
@@ -123,6 +127,75 @@ public:
         }
     }
 
+    /**
+     * @brief Same as `add`, but returns handle to erase this disposable in O(1) later. Returns nullopt in case of disposable was not added.
+     */
+    template<typename TContainer = Container>
+    auto insert(disposable_wrapper disposable) -> std::optional<typename TContainer::handle>
+    {
+        if (disposable.is_disposed_or_same_as(this))
+            return std::nullopt;
+
+        while (true)
+        {
+            State expected{State::None};
+            // need to acquire possible disposables state changing from other `add`
+            if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::acquire, std::memory_order::relaxed))
+            {
+                std::optional<typename TContainer::handle> res{};
+                try
+                {
+                    res = m_disposables.insert(std::move(disposable));
+                }
+                catch(...)
+                {
+                    m_current_state.store(State::None, std::memory_order::release);
+                    throw;
+                }
+                // need to propogate disposables state changing to others
+                m_current_state.store(State::None, std::memory_order::release);
+                return res;
+            }
+
+            if (expected == State::Disposed)
+            {
+                disposable.dispose();
+                return std::nullopt;
+            }
+        }
+    }
+
+    /**
+     * @brief Erases disposable added via `insert` without disposing it
+     */
+    template<typename TContainer = Container>
+    void erase(const typename TContainer::handle& handle)
+    {
+        while (true)
+        {
+            State expected{State::None};
+            // need to acquire possible disposables state changing from other `add` or `remove`
+            if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::acquire, std::memory_order::relaxed))
+            {
+                try
+                {
+                    m_disposables.erase(handle);
+                }
+                catch(...)
+                {
+                    m_current_state.store(State::None, std::memory_order::release);
+                    throw;
+                }
+                // need to propogate disposables state changing to others
+                m_current_state.store(State::None, std::memory_order::release);
+                return;
+            }
+
+            if (expected == State::Disposed)
+                return;
+        }
+    }
+
 protected:
     virtual void dispose_impl() noexcept {}
 
@@ -134,9 +207,16 @@ private:
         Disposed // permanent state after dispose
     };
 
-    Container          m_disposables{};
-    std::atomic<State> m_current_state{};
+    Container                                                m_disposables{};
+    rpp::details::disposables::deduce_atomic_t<State, Mode> m_current_state{};
 };
 
 class composite_disposable : public composite_disposable_impl<rpp::details::disposables::dynamic_disposables_container<0>>{};
+
+/**
+ * @brief Same as rpp::composite_disposable, but for usage from one thread only: no atomic operations at all.
+ *
+ * @ingroup disposables
+ */
+class non_atomic_composite_disposable : public composite_disposable_impl<rpp::details::disposables::dynamic_disposables_container<0>, rpp::details::disposables::AtomicMode::NonAtomic>{};
 } // namespace rpp
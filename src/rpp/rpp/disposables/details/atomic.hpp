@@ -0,0 +1,53 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/disposables/fwd.hpp>
+
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+namespace rpp::details::disposables
+{
+/**
+ * @brief Same interface as `std::atomic` (only part used by disposables), but backed by plain value. Used by disposables accessed from one thread only to avoid atomic read-modify-write operations.
+ */
+template<typename T>
+class non_atomic
+{
+public:
+    non_atomic() = default;
+
+    T load(std::memory_order) const noexcept { return m_value; }
+
+    void store(T value, std::memory_order) noexcept { m_value = value; }
+
+    T exchange(T value, std::memory_order) noexcept { return std::exchange(m_value, value); }
+
+    bool compare_exchange_strong(T& expected, T desired, std::memory_order, std::memory_order) noexcept
+    {
+        if (m_value != expected)
+        {
+            expected = m_value;
+            return false;
+        }
+        m_value = desired;
+        return true;
+    }
+
+private:
+    T m_value{};
+};
+
+template<typename T, AtomicMode Mode>
+using deduce_atomic_t = std::conditional_t<Mode == AtomicMode::Atomic, std::atomic<T>, non_atomic<T>>;
+} // namespace rpp::details::disposables
@@ -12,13 +12,12 @@
 
 #include <rpp/disposables/fwd.hpp>
 
+#include <rpp/disposables/details/atomic.hpp>
 #include <rpp/disposables/interface_disposable.hpp>
 
-#include <atomic>
-
 namespace rpp::details
 {
-template<typename BaseInterface>
+template<typename BaseInterface, disposables::AtomicMode Mode = disposables::AtomicMode::Atomic>
 class base_disposable_impl : public BaseInterface
 {
 public:
@@ -43,7 +42,7 @@ protected:
     virtual void dispose_impl() noexcept = 0;
 
 private:
-    std::atomic_bool m_disposed{};
+    disposables::deduce_atomic_t<bool, Mode> m_disposed{};
 };
 
 using base_disposable           = base_disposable_impl<interface_disposable>;
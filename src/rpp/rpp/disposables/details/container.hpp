@@ -113,6 +113,105 @@ private:
     size_t                                             m_size{};
 };
 
+/**
+ * @brief Container with O(1) insertion and O(1) erasing via handle obtained during insertion.
+ *
+ * @details Disposables are kept in slots, erased slots are reused by next insertions, so, memory is bounded by peak amount of kept disposables. Each insertion obtains unique id, so, handle of already erased disposable never erases another disposable placed into the same slot later. Erased slots at the end are trimmed right away, list of free slots is compacted lazily: only when most of slots are free.
+ */
+class slot_map_disposables_container
+{
+    struct slot
+    {
+        rpp::disposable_wrapper disposable{};
+        size_t                  id{};
+    };
+
+public:
+    struct handle
+    {
+        size_t index;
+        size_t id;
+    };
+
+    slot_map_disposables_container() = default;
+
+    handle insert(rpp::disposable_wrapper d)
+    {
+        const size_t id = ++m_last_id;
+        while (!m_free.empty())
+        {
+            const size_t index = m_free.back();
+            m_free.pop_back();
+            // slot could be trimmed already
+            if (index < m_slots.size())
+            {
+                m_slots[index] = slot{std::move(d), id};
+                return handle{index, id};
+            }
+        }
+
+        m_slots.push_back(slot{std::move(d), id});
+        return handle{m_slots.size() - 1, id};
+    }
+
+    void push_back(const rpp::disposable_wrapper& d) { insert(d); }
+
+    void push_back(rpp::disposable_wrapper&& d) { insert(std::move(d)); }
+
+    void erase(handle h)
+    {
+        if (h.index >= m_slots.size() || m_slots[h.index].id != h.id)
+            return;
+
+        m_slots[h.index] = slot{};
+        if (h.index + 1 == m_slots.size())
+        {
+            while (!m_slots.empty() && m_slots.back().id == 0)
+                m_slots.pop_back();
+        }
+        else
+        {
+            m_free.push_back(h.index);
+        }
+
+        if (m_free.size() > s_compaction_threshold && m_free.size() * 2 > m_slots.size())
+            m_free.erase(std::remove_if(m_free.begin(), m_free.end(), [&](size_t index) { return index >= m_slots.size(); }), m_free.end());
+    }
+
+    void remove(const rpp::disposable_wrapper& d)
+    {
+        for (size_t i = 0; i < m_slots.size(); ++i)
+        {
+            if (m_slots[i].id != 0 && m_slots[i].disposable == d)
+                erase(handle{i, m_slots[i].id});
+        }
+    }
+
+    void dispose() const
+    {
+        for (const auto& s : m_slots)
+        {
+            if (s.id != 0)
+                s.disposable.dispose();
+        }
+    }
+
+    void clear()
+    {
+        m_slots.clear();
+        m_free.clear();
+    }
+
+    size_t size() const { return m_slots.size() - std::count_if(m_free.begin(), m_free.end(), [&](size_t index) { return index < m_slots.size(); }); }
+
+private:
+    static constexpr size_t s_compaction_threshold = 16;
+
+    std::vector<slot>   m_slots{};
+    std::vector<size_t> m_free{};
+    size_t              m_last_id{};
+};
+
 struct none_disposables_container
 {
     [[noreturn]] static void push_back(const rpp::disposable_wrapper&)
@@ -13,6 +13,7 @@
 #include <rpp/disposables/fwd.hpp>
 
 #include <rpp/disposables/interface_disposable.hpp>
+#include <rpp/disposables/interface_requestable_disposable.hpp>
 
 #include <memory>
 #include <variant>
@@ -23,6 +24,9 @@ namespace rpp
  * @brief Wrapper over disposable_ptr to prevent manual checking over nullptr/is_disposed()
  * @details Can keep weak_ptr in case of not owning disposable
  *
+ * @par Performance notes
+ * Read-only checks (`is_disposed`, comparison) of owning wrapper don't touch reference counter of underlying disposable, only non-owning wrapper needs to lock weak_ptr. Operations which can invoke user's code (`dispose`, `add`, `request`) always keep extra reference to underlying disposable during the call: such a call could destroy the wrapper itself.
+ *
  * @ingroup disposables
  */
 template<rpp::constraint::decayed_type TDisposable>
@@ -68,14 +72,22 @@ public:
 
     bool operator==(const disposable_wrapper_impl& other) const
     {
-        return get_original() == other.get_original();
+        return with_original([&](const std::shared_ptr<TDisposable>& original) {
+            return other.with_original([&](const std::shared_ptr<TDisposable>& other_original) { return original == other_original; });
+        });
     }
 
     bool is_disposed() const noexcept
     {
-        if (const auto locked = get_original())
-            return locked->is_disposed();
-        return true;
+        return with_original([](const std::shared_ptr<TDisposable>& original) { return !original || original->is_disposed(); });
+    }
+
+    /**
+     * @brief Same as `is_disposed() || get_original().get() == ptr`, but obtains underlying disposable only once.
+     */
+    bool is_disposed_or_same_as(const interface_disposable* ptr) const noexcept
+    {
+        return with_original([ptr](const std::shared_ptr<TDisposable>& original) { return !original || original.get() == ptr || original->is_disposed(); });
     }
 
     void dispose() const noexcept
@@ -100,6 +112,33 @@ public:
             locked->remove(other);
     }
 
+    void request(size_t count) const noexcept
+        requires std::derived_from<TDisposable, interface_requestable_disposable>
+    {
+        if (const auto locked = get_original())
+            locked->request(count);
+    }
+
+    /**
+     * @brief Casts underlying disposable to `TT` keeping the same ownership (strong or weak). Returns empty wrapper if underlying disposable is not `TT`.
+     */
+    template<std::derived_from<interface_disposable> TT>
+    disposable_wrapper_impl<TT> dynamic_cast_to() const
+    {
+        if (const auto ptr_ptr = std::get_if<std::shared_ptr<TDisposable>>(&m_disposable))
+        {
+            if (auto casted = std::dynamic_pointer_cast<TT>(*ptr_ptr))
+                return disposable_wrapper_impl<TT>::from_shared(std::move(casted));
+        }
+        else if (const auto weak_ptr_ptr = std::get_if<std::weak_ptr<TDisposable>>(&m_disposable))
+        {
+            if (auto casted = std::dynamic_pointer_cast<TT>(weak_ptr_ptr->lock()))
+                return disposable_wrapper_impl<TT>::from_weak(casted);
+        }
+
+        return disposable_wrapper_impl<TT>{};
+    }
+
     std::shared_ptr<TDisposable> get_original() const noexcept
     {
         if (const auto ptr_ptr = std::get_if<std::shared_ptr<TDisposable>>(&m_disposable))
@@ -133,6 +172,23 @@ public:
         return false;
     }
 
+private:
+    /**
+     * @brief Invokes `fn` with underlying disposable (or nullptr) without copying of owning pointer.
+     * @warning `fn` must not invoke any user's code: owning pointer is not protected against destruction of this wrapper.
+     */
+    template<typename Fn>
+    auto with_original(const Fn& fn) const noexcept
+    {
+        if (const auto ptr_ptr = std::get_if<std::shared_ptr<TDisposable>>(&m_disposable))
+            return fn(*ptr_ptr);
+
+        if (const auto ptr_ptr = std::get_if<std::weak_ptr<TDisposable>>(&m_disposable))
+            return fn(ptr_ptr->lock());
+
+        return fn(std::shared_ptr<TDisposable>{});
+    }
+
 private:
     std::variant<std::monostate, std::shared_ptr<TDisposable>, std::weak_ptr<TDisposable>> m_disposable;
 };
@@ -18,16 +18,27 @@ namespace rpp
 {
 struct interface_disposable;
 struct interface_composite_disposable;
+struct interface_requestable_disposable;
 
 template<rpp::constraint::decayed_type TDisposable>
 class disposable_wrapper_impl;
 
 using disposable_wrapper           = disposable_wrapper_impl<interface_disposable>;
 using composite_disposable_wrapper = disposable_wrapper_impl<interface_composite_disposable>;
+using requestable_disposable_wrapper = disposable_wrapper_impl<interface_requestable_disposable>;
 } // namespace rpp
 
 namespace rpp::details::disposables
 {
+/**
+ * @brief Selects if disposable could be accessed from multiple threads at the same time (Atomic) or from one thread only (NonAtomic)
+ */
+enum class AtomicMode
+{
+    NonAtomic = 0,
+    Atomic = 1
+};
+
 template<size_t Count>
 class dynamic_disposables_container;
 
@@ -36,6 +47,8 @@ class static_disposables_container;
 
 struct none_disposables_container;
 
+class slot_map_disposables_container;
+
 namespace constraint
 {
     template<typename T>
@@ -50,9 +63,13 @@ namespace constraint
 
 namespace rpp
 {
+template<details::disposables::constraint::disposable_container Container, details::disposables::AtomicMode Mode = details::disposables::AtomicMode::Atomic>
+class composite_disposable_impl;
+
 class composite_disposable;
+class non_atomic_composite_disposable;
 
-template<rpp::constraint::is_nothrow_invocable Fn>
+template<rpp::constraint::is_nothrow_invocable Fn, details::disposables::AtomicMode Mode = details::disposables::AtomicMode::Atomic>
 class callback_disposable;
 
 class refcount_disposable;
@@ -0,0 +1,40 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/disposables/fwd.hpp>
+
+#include <rpp/disposables/interface_disposable.hpp>
+
+#include <cstddef>
+#include <limits>
+
+namespace rpp
+{
+/**
+ * @brief Disposable of observable supporting backpressure: besides cancellation it allows observer to request more emissions (reactive-streams' `Subscription`).
+ *
+ * @details Such a disposable is passed to observer via `set_upstream`. Backpressure is opt-in: observer enables it by calling `request(n)` right inside of `set_upstream` (before any emission). If nobody requested anything during `set_upstream`, observable emits without any limits as usual.
+ * After that observable never emits more `on_next` than were requested in total. `on_error`/`on_completed` don't need any demand.
+ *
+ * @ingroup disposables
+ */
+struct interface_requestable_disposable : public interface_disposable
+{
+    static constexpr size_t unbounded = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief Request `count` more emissions. `unbounded` disables backpressure at all.
+     * @warning This function must be thread-safe
+     */
+    virtual void request(size_t count) noexcept = 0;
+};
+} // namespace rpp
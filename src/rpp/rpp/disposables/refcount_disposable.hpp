@@ -17,17 +17,32 @@
 #include <rpp/disposables/disposable_wrapper.hpp>
 
 #include <atomic>
-#include <memory>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace rpp::details
 {
+class refcount_disposable_ref;
+
 class refocunt_disposable_state_t final : public rpp::composite_disposable 
 {
 public:
     void dispose_impl() noexcept override
     {
         m_refcount.store(s_disposed, std::memory_order::relaxed);
+
+        std::vector<slot_t> slots{};
+        {
+            std::lock_guard lock{m_mutex};
+            slots.swap(m_slots);
+            m_first_free_slot = s_no_slot;
+        }
+        for (const auto& slot : slots)
+            dispose_ref(slot.ref);
     }
 
     void release()
@@ -57,15 +72,48 @@ public:
         return current_value != s_disposed;
     }
 
+    /**
+     * @brief Keeps weak reference to ref to dispose it with state and passes slot of this ref to it. Returns false if state is already disposed.
+     */
+    bool track_ref(const std::shared_ptr<refcount_disposable_ref>& ref);
+
+    void untrack_ref(size_t slot) noexcept
+    {
+        std::lock_guard lock{m_mutex};
+        // slots could be already taken by dispose_impl
+        if (slot >= m_slots.size())
+            return;
+
+        m_slots[slot].ref.reset();
+        m_slots[slot].next_free = std::exchange(m_first_free_slot, slot);
+    }
+
+private:
+    static void dispose_ref(const std::weak_ptr<refcount_disposable_ref>& ref) noexcept;
+    size_t      acquire_slot_unsafe();
+
 private:
     std::atomic<size_t>     m_refcount{0};
     constexpr static size_t s_disposed = std::numeric_limits<size_t>::max();
+    constexpr static size_t s_no_slot  = std::numeric_limits<size_t>::max();
+
+    // free slots are linked into list via `next_free`, so, disposed refs are untracked in O(1) without allocations
+    struct slot_t
+    {
+        std::weak_ptr<refcount_disposable_ref> ref{};
+        size_t                                 next_free{s_no_slot};
+    };
+
+    std::mutex          m_mutex{};
+    std::vector<slot_t> m_slots{};
+    size_t              m_first_free_slot{s_no_slot};
 };
 }
 
 namespace rpp
 {
 class refcount_disposable : public std::enable_shared_from_this<refcount_disposable> {
+    friend class details::refcount_disposable_ref;
 
 public:
     refcount_disposable() = default;
@@ -75,22 +123,13 @@ public:
         return m_state.is_disposed();
     }
 
-    composite_disposable_wrapper add_ref()
-    {
-        if (m_state.add_ref())
-        {
-            auto inner   = std::make_shared<rpp::composite_disposable_impl<rpp::details::disposables::dynamic_disposables_container<1>>>();
-            auto as_weak = rpp::disposable_wrapper::from_weak(inner);
-            m_state.add(as_weak);
-            inner->add([s = shared_from_this(), as_weak]() noexcept {
-                s->m_state.remove(as_weak);
-                s->m_state.release();
-            });
-            return composite_disposable_wrapper{inner};
-        }
-
-        return composite_disposable_wrapper{};
-    }
+    /**
+     * @brief Creates new reference to this refcount disposable: underlying disposable would be disposed once all references are disposed.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for reference itself. Slot of reference inside refcount disposable is reused once reference is disposed.
+     */
+    composite_disposable_wrapper add_ref();
 
     composite_disposable_wrapper get_underlying()
     {
@@ -101,3 +140,80 @@ private:
     details::refocunt_disposable_state_t m_state{};
 };
 } // namespace rpp
+
+namespace rpp::details
+{
+/**
+ * @brief Reference obtained from rpp::refcount_disposable::add_ref. It is composite itself to keep disposables related to this reference.
+ */
+class refcount_disposable_ref final : public rpp::composite_disposable_impl<rpp::details::disposables::dynamic_disposables_container<0>>
+{
+public:
+    explicit refcount_disposable_ref(std::shared_ptr<refcount_disposable>&& owner)
+        : m_owner{std::move(owner)}
+    {
+    }
+
+    // called under lock of owner's state before any access from other threads
+    void set_slot(size_t slot) { m_slot = slot; }
+
+private:
+    void dispose_impl() noexcept override
+    {
+        // called only once, so, owner is not accessed concurrently
+        const auto owner = std::move(m_owner);
+        if (m_slot)
+            owner->m_state.untrack_ref(m_slot.value());
+        owner->m_state.release();
+    }
+
+private:
+    std::shared_ptr<refcount_disposable> m_owner;
+    std::optional<size_t>                m_slot{};
+};
+
+inline bool refocunt_disposable_state_t::track_ref(const std::shared_ptr<refcount_disposable_ref>& ref)
+{
+    std::lock_guard lock{m_mutex};
+    // dispose_impl takes refs under the same lock right after marking state as disposed
+    if (is_disposed())
+        return false;
+
+    const size_t slot = acquire_slot_unsafe();
+    m_slots[slot].ref = ref;
+    ref->set_slot(slot);
+    return true;
+}
+
+inline size_t refocunt_disposable_state_t::acquire_slot_unsafe()
+{
+    if (m_first_free_slot == s_no_slot)
+    {
+        m_slots.emplace_back();
+        return m_slots.size() - 1;
+    }
+
+    return std::exchange(m_first_free_slot, m_slots[m_first_free_slot].next_free);
+}
+
+inline void refocunt_disposable_state_t::dispose_ref(const std::weak_ptr<refcount_disposable_ref>& ref) noexcept
+{
+    if (const auto locked = ref.lock())
+        locked->dispose();
+}
+} // namespace rpp::details
+
+namespace rpp
+{
+inline composite_disposable_wrapper refcount_disposable::add_ref()
+{
+    if (!m_state.add_ref())
+        return composite_disposable_wrapper{};
+
+    auto ref = std::make_shared<details::refcount_disposable_ref>(shared_from_this());
+    if (!m_state.track_ref(ref))
+        ref->dispose();
+
+    return composite_disposable_wrapper{std::move(ref)};
+}
+} // namespace rpp
@@ -25,6 +25,9 @@ public:
     using expected_disposable_strategy = typename TStrategy::template updated_disposable_strategy<typename base::expected_disposable_strategy>;
     using value_type = typename TStrategy::template result_value<typename base::value_type>;
 
+    // operator can forward disposable of upstream as is
+    static constexpr bool is_requestable = base::is_requestable;
+
     observable_chain_strategy(const TStrategy& strategy, const TStrategies&... strategies)
         : m_strategy(strategy)
         , m_strategies(strategies...)
@@ -40,7 +43,9 @@ public:
     template<rpp::constraint::observer_of_type<value_type> Observer>
     void subscribe(Observer&& observer) const
     {
-        if constexpr (rpp::constraint::operator_lift_with_disposable_strategy<TStrategy, typename base::value_type, typename base::expected_disposable_strategy>)
+        if constexpr (base::is_requestable && rpp::constraint::operator_lift_with_requestable_upstream<TStrategy, typename base::value_type, typename base::expected_disposable_strategy>)
+            m_strategies.subscribe(m_strategy.template lift_with_requestable_upstream<typename base::value_type, typename base::expected_disposable_strategy>(std::forward<Observer>(observer)));
+        else if constexpr (rpp::constraint::operator_lift_with_disposable_strategy<TStrategy, typename base::value_type, typename base::expected_disposable_strategy>)
             m_strategies.subscribe(m_strategy.template lift_with_disposable_strategy<typename base::value_type, typename base::expected_disposable_strategy>(std::forward<Observer>(observer)));
         else if constexpr (rpp::constraint::operator_lift<TStrategy, typename base::value_type>)
             m_strategies.subscribe(m_strategy.template lift<typename base::value_type>(std::forward<Observer>(observer)));
@@ -60,6 +65,9 @@ public:
     using expected_disposable_strategy = rpp::details::observables::deduce_disposable_strategy_t<TStrategy>;
     using value_type                   = typename TStrategy::value_type;
 
+    static constexpr bool is_synchronous = rpp::details::observables::synchronous_strategy<TStrategy>;
+    static constexpr bool is_requestable = rpp::details::observables::requestable_strategy<TStrategy>;
+
     observable_chain_strategy(const TStrategy& strategy)
         : m_strategy(strategy)
     {
@@ -14,11 +14,7 @@
 
 namespace rpp::details::observables
 {
-enum class AtomicMode
-{
-    NonAtomic = 0,
-    Atomic = 1
-};
+using rpp::details::disposables::AtomicMode;
 
 template<AtomicMode Mode>
 using deduce_atomic_bool = std::conditional_t<Mode == AtomicMode::Atomic, observers::atomic_bool, observers::non_atomic_bool>;
@@ -98,4 +94,40 @@ concept disposable_strategy = requires(const T&)
     requires observers::constraint::disposable_strategy<typename T::disposable_strategy>;
 };
 }
+
+namespace details
+{
+    template<typename T>
+    struct fixed_disposable_strategy_traits
+    {
+        static constexpr bool is_fixed = false;
+    };
+
+    template<size_t Count, AtomicMode Mode>
+    struct fixed_disposable_strategy_traits<fixed_disposable_strategy_selector<Count, Mode>>
+    {
+        static constexpr bool       is_fixed = true;
+        static constexpr size_t     count    = Count;
+        static constexpr AtomicMode mode     = Mode;
+    };
+
+    template<size_t Multiplier, typename... Strategies>
+    auto* deduce_combined_disposable_strategy()
+    {
+        if constexpr ((fixed_disposable_strategy_traits<Strategies>::is_fixed && ...))
+        {
+            constexpr size_t     count = Multiplier * (size_t{} + ... + fixed_disposable_strategy_traits<Strategies>::count);
+            constexpr AtomicMode mode  = ((fixed_disposable_strategy_traits<Strategies>::mode == AtomicMode::Atomic) || ...) ? AtomicMode::Atomic : AtomicMode::NonAtomic;
+            return static_cast<fixed_disposable_strategy_selector<count, mode>*>(nullptr);
+        }
+        else
+            return static_cast<default_disposable_strategy_selector*>(nullptr);
+    }
+}
+
+/**
+ * @brief Strategy for observer/disposable obtaining disposables from each of `Strategies` `Multiplier` times: fixed one with total count of disposables in case of all of them are fixed, default one otherwise.
+ */
+template<size_t Multiplier, constraint::disposable_strategy... Strategies>
+using combined_disposable_strategy_t = std::remove_pointer_t<decltype(details::deduce_combined_disposable_strategy<Multiplier, Strategies...>())>;
 }
\ No newline at end of file
@@ -13,64 +13,119 @@
 
 #include <rpp/observers/dynamic_observer.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace rpp::details::observables
 {
-template<typename T, typename Observable>
-void forwarding_subscribe(const void* const ptr, dynamic_observer<T>&& obs)
-{
-    static_cast<const Observable*>(ptr)->subscribe(std::move(obs));
-}
-
 template<rpp::constraint::decayed_type Type>
 class dynamic_strategy final
 {
+    // enough to keep typical chain of several operators over source without heap allocation
+    static constexpr size_t s_inline_size = 48;
+
+    template<typename Observable>
+    static constexpr bool s_is_inlined = sizeof(Observable) <= s_inline_size
+                                      && alignof(Observable) <= alignof(std::max_align_t)
+                                      && std::is_nothrow_move_constructible_v<Observable>
+                                      && std::is_copy_constructible_v<Observable>;
+
 public:
     using value_type = Type;
 
     template<rpp::constraint::observable_strategy<Type> Strategy>
         requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
     explicit dynamic_strategy(observable<Type, Strategy>&& obs)
-        : m_forwarder{std::make_shared<observable<Type, Strategy>>(std::move(obs))}
-        , m_vtable{vtable::template create<observable<Type, Strategy>>()}
+        : m_vtable{vtable::template create<observable<Type, Strategy>>()}
     {
+        emplace<observable<Type, Strategy>>(std::move(obs));
     }
 
     template<rpp::constraint::observable_strategy<Type> Strategy>
         requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
     explicit dynamic_strategy(const observable<Type, Strategy>& obs)
-        : m_forwarder{std::make_shared<observable<Type, Strategy>>(obs)}
-        , m_vtable{vtable::template create<observable<Type, Strategy>>()}
+        : m_vtable{vtable::template create<observable<Type, Strategy>>()}
+    {
+        emplace<observable<Type, Strategy>>(obs);
+    }
+
+    dynamic_strategy(const dynamic_strategy& other)
+        : m_vtable{other.m_vtable}
+    {
+        m_vtable->copy(other.m_storage, m_storage);
+    }
+
+    dynamic_strategy(dynamic_strategy&& other) noexcept
+        : m_vtable{other.m_vtable}
     {
+        m_vtable->move(other.m_storage, m_storage);
     }
 
-    dynamic_strategy(const dynamic_strategy&)     = default;
-    dynamic_strategy(dynamic_strategy&&) noexcept = default;
+    dynamic_strategy& operator=(const dynamic_strategy&)     = delete;
+    dynamic_strategy& operator=(dynamic_strategy&&) noexcept = delete;
+
+    ~dynamic_strategy() noexcept
+    {
+        m_vtable->destroy(m_storage);
+    }
 
     template<rpp::constraint::observer_strategy<Type> ObserverStrategy>
     void subscribe(observer<Type, ObserverStrategy>&& observer) const
     {
-        m_vtable->subscribe(m_forwarder.get(), std::move(observer).as_dynamic());
+        m_vtable->subscribe(m_storage, std::move(observer).as_dynamic());
     }
 
 private:
+    /**
+     * @brief Small observables are kept inline and copied by value, big (or not copyable) ones are kept on heap and shared between copies.
+     */
+    template<typename Observable>
+    using stored_t = std::conditional_t<s_is_inlined<Observable>, Observable, std::shared_ptr<const Observable>>;
+
+    template<typename Observable, typename... Args>
+    void emplace(Args&&... args)
+    {
+        static_assert(sizeof(stored_t<Observable>) <= s_inline_size);
+
+        if constexpr (s_is_inlined<Observable>)
+            std::construct_at(reinterpret_cast<Observable*>(m_storage), std::forward<Args>(args)...);
+        else
+            std::construct_at(reinterpret_cast<stored_t<Observable>*>(m_storage), std::make_shared<const Observable>(std::forward<Args>(args)...));
+    }
+
     struct vtable
     {
-        void (*subscribe)(const void*, dynamic_observer<Type>&&){};
+        void (*subscribe)(const std::byte*, dynamic_observer<Type>&&){};
+        void (*copy)(const std::byte*, std::byte*){};
+        void (*move)(std::byte*, std::byte*) noexcept {};
+        void (*destroy)(std::byte*) noexcept {};
 
         template<rpp::constraint::observable Observable>
         static const vtable* create() noexcept
         {
+            using stored = stored_t<Observable>;
+
             static vtable s_res{
-                .subscribe = forwarding_subscribe<Type, Observable>};
+                .subscribe = [](const std::byte* storage, dynamic_observer<Type>&& obs) {
+                    const auto& stored_value = *std::launder(reinterpret_cast<const stored*>(storage));
+                    if constexpr (s_is_inlined<Observable>)
+                        stored_value.subscribe(std::move(obs));
+                    else
+                        stored_value->subscribe(std::move(obs));
+                },
+                .copy    = [](const std::byte* from, std::byte* to) { std::construct_at(reinterpret_cast<stored*>(to), *std::launder(reinterpret_cast<const stored*>(from))); },
+                .move    = [](std::byte* from, std::byte* to) noexcept { std::construct_at(reinterpret_cast<stored*>(to), std::move(*std::launder(reinterpret_cast<stored*>(from)))); },
+                .destroy = [](std::byte* storage) noexcept { std::destroy_at(std::launder(reinterpret_cast<stored*>(storage))); },
+            };
             return &s_res;
         }
     };
 
 private:
-    std::shared_ptr<void> m_forwarder;
-    const vtable*         m_vtable;
+    alignas(std::max_align_t) std::byte m_storage[s_inline_size];
+    const vtable* m_vtable;
 };
 }
@@ -90,6 +90,66 @@ template<typename T>
 concept observable = rpp::utils::details::is_observable_t<std::decay_t<T>>::type::value;
 }
 
+namespace rpp::details::observables
+{
+/**
+ * @brief Strategy of observable which emits everything right inside of `subscribe` call in caller's thread (or doesn't emit at all) and doesn't keep observer after it. Strategy opts-in via `static constexpr bool is_synchronous = true;`
+ *
+ * @details Operators can use it to avoid any synchronization for such an observables.
+ */
+template<typename S>
+concept synchronous_strategy = requires { requires std::decay_t<S>::is_synchronous; };
+
+template<typename TObservable>
+struct is_synchronous_observable
+{
+    template<typename T, typename Strategy>
+    consteval static std::bool_constant<synchronous_strategy<Strategy>> deduce(const rpp::observable<T, Strategy>*);
+    consteval static std::false_type deduce(...);
+
+    static constexpr bool value = decltype(deduce(std::declval<std::decay_t<TObservable>*>()))::value;
+};
+} // namespace rpp::details::observables
+
+namespace rpp::constraint
+{
+/**
+ * @brief Observable emits all its emissions synchronously during subscription, see rpp::details::observables::synchronous_strategy
+ */
+template<typename T>
+concept synchronous_observable = observable<T> && rpp::details::observables::is_synchronous_observable<T>::value;
+}
+
+namespace rpp::details::observables
+{
+/**
+ * @brief Strategy of observable which can pass rpp::interface_requestable_disposable to observer via `set_upstream` (like rpp::source::from_iterable_on_demand). Strategy opts-in via `static constexpr bool is_requestable = true;`
+ *
+ * @details Operators compile their backpressure handling only for such an observables, so, push-only chains don't pay anything for it. Type-erased observables (rpp::dynamic_observable) don't propagate it.
+ */
+template<typename S>
+concept requestable_strategy = requires { requires std::decay_t<S>::is_requestable; };
+
+template<typename TObservable>
+struct is_requestable_observable
+{
+    template<typename T, typename Strategy>
+    consteval static std::bool_constant<requestable_strategy<Strategy>> deduce(const rpp::observable<T, Strategy>*);
+    consteval static std::false_type deduce(...);
+
+    static constexpr bool value = decltype(deduce(std::declval<std::decay_t<TObservable>*>()))::value;
+};
+} // namespace rpp::details::observables
+
+namespace rpp::constraint
+{
+/**
+ * @brief Observable can pass rpp::interface_requestable_disposable to its observer, see rpp::details::observables::requestable_strategy
+ */
+template<typename T>
+concept requestable_observable = observable<T> && rpp::details::observables::is_requestable_observable<T>::value;
+}
+
 namespace rpp
 {
 template<rpp::constraint::observable OriginalObservable, rpp::constraint::subject Subject>
@@ -152,6 +212,18 @@ concept operator_lift_with_disposable_strategy = requires(const Op& op, dynamic_
     {op.template lift_with_disposable_strategy<Type, DisposableStrategy>(std::move(observer))} -> rpp::constraint::observer_of_type<Type>;
 };
 
+/**
+ * @brief Operator provides special flavour of observer for upstream which can pass rpp::interface_requestable_disposable (see rpp::details::observables::requestable_strategy). Used instead of lift only for such an upstreams.
+ */
+template<typename Op, typename Type, typename DisposableStrategy>
+concept operator_lift_with_requestable_upstream = requires(const Op& op, dynamic_observer<typename std::decay_t<Op>::template result_value<Type>>&& observer)
+{
+    typename std::decay_t<Op>::template result_value<Type>;
+    requires details::observables::constraint::disposable_strategy<typename std::decay_t<Op>::template updated_disposable_strategy<details::observables::bool_disposable_strategy_selector>>;
+
+    {op.template lift_with_requestable_upstream<Type, DisposableStrategy>(std::move(observer))} -> rpp::constraint::observer_of_type<Type>;
+};
+
 template<typename Op, typename Type, typename DisposableStrategy>
 concept operator_chain = operator_subscribe<Op, Type> || operator_lift<Op, Type> || operator_lift_with_disposable_strategy<Op, Type, DisposableStrategy>;
 
@@ -31,6 +31,7 @@
  */
 
 #include <rpp/operators/buffer.hpp>
+#include <rpp/operators/concat_map.hpp>
 #include <rpp/operators/flat_map.hpp>
 #include <rpp/operators/group_by.hpp>
 #include <rpp/operators/map.hpp>
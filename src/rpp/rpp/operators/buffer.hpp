@@ -13,36 +13,70 @@
 #include <rpp/operators/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
 #include <cstddef>
+#include <memory>
+#include <type_traits>
 
 namespace rpp::operators::details
 {
-template<rpp::constraint::observer TObserver>
+/**
+ * @brief Translates downstream's demand in buckets to upstream's demand in items
+ */
+class buffer_requestable_disposable final : public rpp::interface_requestable_disposable
+{
+public:
+    buffer_requestable_disposable(rpp::requestable_disposable_wrapper&& upstream, size_t count)
+        : m_upstream{std::move(upstream)}
+        , m_count{count}
+    {
+    }
+
+    bool is_disposed() const noexcept override { return m_upstream.is_disposed(); }
+
+    void dispose() noexcept override { m_upstream.dispose(); }
+
+    void request(size_t count) noexcept override
+    {
+        m_upstream.request(count > unbounded / m_count ? unbounded : count * m_count);
+    }
+
+private:
+    rpp::requestable_disposable_wrapper m_upstream;
+    size_t                              m_count;
+};
+
+template<rpp::constraint::observer TObserver, bool RequestableUpstream = false>
 class buffer_observer_strategy
 {
     using container = rpp::utils::extract_observer_type_t<TObserver>;
     using value_type = typename container::value_type;
     static_assert(std::same_as<container, std::vector<value_type>>);
 
+    using requestable_t = std::conditional_t<RequestableUpstream, std::shared_ptr<buffer_requestable_disposable>, rpp::utils::none>;
+
 public:
     using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
     buffer_observer_strategy(TObserver&& observer, size_t count)
         : m_observer{std::move(observer)}
+        , m_bucket_size{std::max(size_t{1}, count)}
     {
-        m_bucket.reserve(std::max(size_t{1}, count));
+        m_bucket.reserve(m_bucket_size);
     }
 
     template<typename T>
     void on_next(T&& v) const
     {
         m_bucket.push_back(std::forward<T>(v));
-        if (m_bucket.size() == m_bucket.capacity())
+        if (m_bucket.size() == m_bucket_size)
         {
             m_observer.on_next(std::move(m_bucket));
+            // moved-from vector has no capacity anymore
             m_bucket.clear();
+            m_bucket.reserve(m_bucket_size);
         }
     }
 
@@ -55,22 +89,51 @@ public:
         m_observer.on_completed();
     }
 
-    void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
+    void set_upstream(const disposable_wrapper& d)
+    {
+        if constexpr (RequestableUpstream)
+        {
+            if (auto requestable = d.dynamic_cast_to<rpp::interface_requestable_disposable>(); requestable.has_underlying())
+            {
+                // owned by buffer as any other upstream is owned by its observable, observer obtains only weak reference
+                m_requestable = std::make_shared<buffer_requestable_disposable>(std::move(requestable), m_bucket_size);
+                m_observer.set_upstream(disposable_wrapper::from_weak(m_requestable));
+                return;
+            }
+        }
+        m_observer.set_upstream(d);
+    }
 
     bool is_disposed() const { return m_observer.is_disposed(); }
 
 private:
-    RPP_NO_UNIQUE_ADDRESS TObserver m_observer;
-    mutable std::vector<value_type>  m_bucket;
+    RPP_NO_UNIQUE_ADDRESS TObserver     m_observer;
+    size_t                              m_bucket_size;
+    mutable std::vector<value_type>     m_bucket;
+    RPP_NO_UNIQUE_ADDRESS requestable_t m_requestable{};
 };
 
-struct buffer_t : public operators::details::operator_observable_strategy_different_types<buffer_observer_strategy, rpp::utils::types<>, size_t>
+struct buffer_t
 {
     template<rpp::constraint::decayed_type T>
     using result_value = std::vector<T>;
 
     template<rpp::details::observables::constraint::disposable_strategy Prev>
     using updated_disposable_strategy = Prev;
+
+    size_t count;
+
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer>
+    auto lift(Observer&& observer) const
+    {
+        return rpp::observer<Type, buffer_observer_strategy<std::decay_t<Observer>>>{std::forward<Observer>(observer), count};
+    }
+
+    template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
+    auto lift_with_requestable_upstream(Observer&& observer) const
+    {
+        return rpp::observer<Type, buffer_observer_strategy<std::decay_t<Observer>, true>>{std::forward<Observer>(observer), count};
+    }
 };
 }
 
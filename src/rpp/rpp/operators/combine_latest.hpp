@@ -18,26 +18,80 @@
 #include <rpp/operators/details/utils.hpp>
 #include <rpp/schedulers/current_thread.hpp>
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <tuple>
+#include <utility>
 
 namespace rpp::operators::details
 {
-template<rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... Args>
-class combine_latest_disposable final : public composite_disposable
+template<rpp::constraint::observer Observer, rpp::details::disposables::constraint::disposable_container Container, typename TSelector, rpp::constraint::decayed_type... Args>
+class combine_latest_disposable final : public composite_disposable_impl<Container>
 {
+    struct completed
+    {
+    };
+
+    // values are updated, combined and sent serially, so, no any guarding is needed for them
+    struct handler
+    {
+        combine_latest_disposable* self;
+
+        template<size_t I, typename T>
+            requires (I < sizeof...(Args))
+        void operator()(std::in_place_index_t<I>, T&& v) const
+        {
+            if (self->m_is_terminated)
+                return;
+
+            self->m_values.template get<I>().emplace(std::forward<T>(v));
+            self->m_values.apply([this](const std::optional<Args>&... vals) {
+                if ((vals.has_value() && ...))
+                    self->m_observer.on_next(self->m_selector(vals.value()...));
+            });
+        }
+
+        void operator()(std::in_place_index_t<sizeof...(Args)>, const std::exception_ptr& err) const
+        {
+            if (!std::exchange(self->m_is_terminated, true))
+                self->m_observer.on_error(err);
+        }
+
+        void operator()(std::in_place_index_t<sizeof...(Args) + 1>, completed) const
+        {
+            if (!std::exchange(self->m_is_terminated, true))
+                self->m_observer.on_completed();
+        }
+    };
+
 public:
     explicit combine_latest_disposable(Observer&& observer, const TSelector& selector)
-        : observer_with_mutex{std::move(observer)}
-        , selector{selector}
+        : m_observer{std::move(observer)}
+        , m_selector{selector}
     {
     }
 
-    pointer_under_lock<Observer> get_observer_under_lock() { return pointer_under_lock{observer_with_mutex}; }
+    /**
+     * @brief Expected to be called before any emission (during subscription)
+     */
+    void set_upstream(const rpp::disposable_wrapper& d) { m_observer.set_upstream(d); }
 
-    rpp::utils::tuple<std::optional<Args>...>& get_values() { return values; }
+    template<size_t I, typename T>
+    void on_next(T&& v)
+    {
+        m_drain.template emit<I>(handler{this}, std::forward<T>(v));
+    }
 
-    const TSelector& get_selector() const { return selector; }
+    void on_error(const std::exception_ptr& err)
+    {
+        m_drain.template emit<sizeof...(Args)>(handler{this}, err);
+    }
+
+    void on_completed()
+    {
+        m_drain.template emit<sizeof...(Args) + 1>(handler{this}, completed{});
+    }
 
     bool decrement_on_completed()
     {
@@ -46,17 +100,19 @@ public:
     }
 
 private:
-    value_with_mutex<Observer>                observer_with_mutex{};
-    rpp::utils::tuple<std::optional<Args>...> values{};
-    RPP_NO_UNIQUE_ADDRESS TSelector           selector;
+    Observer                                  m_observer;
+    rpp::utils::tuple<std::optional<Args>...> m_values{};
+    RPP_NO_UNIQUE_ADDRESS TSelector           m_selector;
+    bool                                      m_is_terminated{};
 
-    std::atomic_size_t m_on_completed_needed{sizeof...(Args)};
+    drain_loop<Args..., std::exception_ptr, completed> m_drain{};
+    std::atomic_size_t                                 m_on_completed_needed{sizeof...(Args)};
 };
 
-template<size_t I, rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... Args>
+template<size_t I, rpp::constraint::observer Observer, rpp::details::disposables::constraint::disposable_container Container, typename TSelector, rpp::constraint::decayed_type... Args>
 struct combine_latest_observer_strategy
 {
-    std::shared_ptr<combine_latest_disposable<Observer, TSelector, Args...>> disposable{};
+    std::shared_ptr<combine_latest_disposable<Observer, Container, TSelector, Args...>> disposable{};
 
     void set_upstream(const rpp::disposable_wrapper& d) const
     {
@@ -71,20 +127,13 @@ struct combine_latest_observer_strategy
     template<typename T>
     void on_next(T&& v) const
     {
-        // mutex need to be locked during changing of values, generating new values and sending of new values due to we can't update value while we are sending old one
-        const auto observer = disposable->get_observer_under_lock();
-        disposable->get_values().template get<I>().emplace(std::forward<T>(v));
-
-        disposable->get_values().apply([this, &observer](const std::optional<Args>&... vals) {
-            if ((vals.has_value() && ...))
-                observer->on_next(disposable->get_selector()(vals.value()...));
-        });
+        disposable->template on_next<I>(std::forward<T>(v));
     }
 
     void on_error(const std::exception_ptr& err) const
     {
         disposable->dispose();
-        disposable->get_observer_under_lock()->on_error(err);
+        disposable->on_error(err);
     }
 
     void on_completed() const
@@ -92,7 +141,7 @@ struct combine_latest_observer_strategy
         if (disposable->decrement_on_completed())
         {
             disposable->dispose();
-            disposable->get_observer_under_lock()->on_completed();
+            disposable->on_completed();
         }
     }
 };
@@ -123,19 +172,21 @@ private:
     static void subscribe_impl(Observer&& observer, const observable_chain_strategy<Strategies...>& observable_strategy, const TSelector& selector, const TObservables&... observables)
     {
         using ExpectedValue = typename observable_chain_strategy<Strategies...>::value_type;
-        using Disposable    = combine_latest_disposable<Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>;
+        // all observables put their disposables into the same disposable
+        using Container     = typename rpp::details::observables::combined_disposable_strategy_t<1, typename observable_chain_strategy<Strategies...>::expected_disposable_strategy, rpp::details::observables::deduce_disposable_strategy_t<TObservables>...>::disposable_container;
+        using Disposable    = combine_latest_disposable<Observer, Container, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>;
 
         auto disposable = std::make_shared<Disposable>(std::forward<Observer>(observer), selector);
-        disposable->get_observer_under_lock()->set_upstream(rpp::disposable_wrapper::from_weak(disposable));
+        disposable->set_upstream(rpp::disposable_wrapper::from_weak(disposable));
         subscribe<std::decay_t<ExpectedValue>>(disposable, std::index_sequence_for<TObservables...>{}, observables...);
 
-        observable_strategy.subscribe(rpp::observer<ExpectedValue, combine_latest_observer_strategy<0, std::decay_t<Observer>, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{std::move(disposable)});
+        observable_strategy.subscribe(rpp::observer<ExpectedValue, combine_latest_observer_strategy<0, std::decay_t<Observer>, Container, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{std::move(disposable)});
     }
 
-    template<typename ExpectedValue, rpp::constraint::observer Observer, size_t... I>
-    static void subscribe(std::shared_ptr<combine_latest_disposable<Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>> disposable, std::index_sequence<I...>, const TObservables&... observables)
+    template<typename ExpectedValue, rpp::constraint::observer Observer, rpp::details::disposables::constraint::disposable_container Container, size_t... I>
+    static void subscribe(std::shared_ptr<combine_latest_disposable<Observer, Container, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>> disposable, std::index_sequence<I...>, const TObservables&... observables)
     {
-        (..., observables.subscribe(rpp::observer<rpp::utils::extract_observable_type_t<TObservables>, combine_latest_observer_strategy<I + 1, Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{disposable}));
+        (..., observables.subscribe(rpp::observer<rpp::utils::extract_observable_type_t<TObservables>, combine_latest_observer_strategy<I + 1, Observer, Container, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{disposable}));
     }
 };
 }
@@ -157,7 +208,7 @@ namespace rpp::operators
  * @par Performance notes:
  * - 1 heap allocation for disposable
  * - each value from any observable copied/moved to internal storage
- * - mutex acquired every time value obtained
+ * - values are updated and combined serially via lock-free queue-drain: no locks, concurrent emissions are queued (1 heap allocation per queued emission) and processed by thread which is emitting right now
  *
  * @param selector is applied to current emission of current observable and latests emissions from observables
  * @param observables are observables whose emissions would be combined with current observable
@@ -196,7 +247,7 @@ auto combine_latest(TSelector&& selector, TObservable&& observable, TObservables
  * @par Performance notes:
  * - 1 heap allocation for disposable
  * - each value from any observable copied/moved to internal storage
- * - mutex acquired every time value obtained
+ * - values are updated and combined serially via lock-free queue-drain: no locks, concurrent emissions are queued (1 heap allocation per queued emission) and processed by thread which is emitting right now
  *
  * @param observables are observables whose emissions would be combined when any observable sends new value
  * @warning #include <rpp/operators/combine_latest.hpp>
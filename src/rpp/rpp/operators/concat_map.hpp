@@ -0,0 +1,45 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/operators/flat_map.hpp>
+
+namespace rpp::operators
+{
+/**
+ * @brief Transform the items emitted by an Observable into Observables, then flatten the emissions from those into a single Observable without interleaving: next Observable is subscribed only after completion of previous one
+ *
+ * @marble concat_map
+        {
+            source observable                     : +--1--2--3--|
+            operator "concat_map: x=>just(x,x+1)" : +--12-23-34-|
+        }
+ *
+ * @details Actually it makes `map(callable)` and then `merge(1)`: Observables obtained while previous one is still active are buffered and subscribed in order of arrival.
+ *
+ * @par Performance notes:
+ * - No locks: buffered Observables and completions are serialized via lock-free queue-drain
+ *
+ * @param callable function that returns an observable for each item emitted by the source observable.
+ * @warning #include <rpp/operators/concat_map.hpp>
+ *
+ * @ingroup transforming_operators
+ * @see https://reactivex.io/documentation/operators/flatmap.html
+ */
+template<typename Fn>
+    requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+auto concat_map(Fn&& callable)
+{
+    return flat_map(std::forward<Fn>(callable), 1);
+}
+} // namespace rpp::operators
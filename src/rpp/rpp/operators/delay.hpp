@@ -14,10 +14,14 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/operators/details/strategy.hpp>
+#include <rpp/operators/details/utils.hpp>
+#include <rpp/utils/ring_buffer.hpp>
 
+#include <atomic>
 #include <mutex>
-#include <queue>
+#include <variant>
 
 namespace rpp::operators::details
 {
@@ -31,11 +35,17 @@ struct emission
     {
     }
 
-    std::variant<T, std::exception_ptr, rpp::utils::none> value{};
-    rpp::schedulers::time_point                           time_point{};
+    T                           value;
+    rpp::schedulers::time_point time_point;
 };
 
-template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+/**
+ * @brief State of delay/observe_on.
+ *
+ * @details Producer appends values to `queue` under lock, consumer swaps the whole `queue` with its own (empty) `batch` under the same lock and emits batch without any locks. Both buffers keep their capacity, so steady-state emission doesn't touch allocator. Terminal events are kept out of band, so, per-item layout is just value + time point.
+ * @details observe_on forwards error immediately: if consumer is not emitting batch right now, producer clears both buffers and emits error itself, else it raises `is_error_pending` and consumer drops rest of batch and emits error right after current item.
+ */
+template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, bool RequestableUpstream>
 struct delay_disposable final : public rpp::composite_disposable_impl<Container>
 {
     using T = rpp::utils::extract_observer_type_t<Observer>;
@@ -56,29 +66,43 @@ struct delay_disposable final : public rpp::composite_disposable_impl<Container>
     RPP_NO_UNIQUE_ADDRESS Worker worker;
     rpp::schedulers::duration    delay;
 
-    std::mutex              mutex{};
-    std::queue<emission<T>> queue;
-    bool                    is_active{};
+    std::mutex                                                         mutex{};
+    rpp::utils::ring_buffer<emission<T>>                               queue{};
+    std::variant<std::monostate, std::exception_ptr, rpp::utils::none> terminal{};
+    rpp::schedulers::time_point                                        terminal_time_point{};
+    bool                                                               is_active{};
+    bool                                                               is_emitting{};
+    std::atomic_bool                                                   is_error_pending{};
+
+    // accessed only by draining thread while `is_emitting`
+    rpp::utils::ring_buffer<emission<T>> batch{};
+
+    // queue is limited by prefetch in case of backpressured upstream, accessed only by draining thread after set_upstream
+    RPP_NO_UNIQUE_ADDRESS upstream_demand<RequestableUpstream> demand{};
 };
 
-template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, bool RequestableUpstream>
 struct delay_disposable_wrapper
 {
-    std::shared_ptr<delay_disposable<Observer, Worker, Container>> disposable{};
+    std::shared_ptr<delay_disposable<Observer, Worker, Container, RequestableUpstream>> disposable{};
 
     bool is_disposed() const { return disposable->is_disposed(); }
 
     void on_error(const std::exception_ptr& err) const { disposable->observer.on_error(err); }
 };
 
-template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, bool ClearOnError>
+template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, bool ClearOnError, bool RequestableUpstream>
 struct delay_observer_strategy
 {
-    std::shared_ptr<delay_disposable<Observer, Worker, Container>> disposable{};
+    using disposable_t = delay_disposable<Observer, Worker, Container, RequestableUpstream>;
+    using wrapper_t    = delay_disposable_wrapper<Observer, Worker, Container, RequestableUpstream>;
+
+    std::shared_ptr<disposable_t> disposable{};
 
     void set_upstream(const rpp::disposable_wrapper& d) const
     {
         disposable->add(d);
+        disposable->demand.set_upstream(d, backpressure_prefetch);
     }
 
     bool is_disposed() const
@@ -89,80 +113,134 @@ struct delay_observer_strategy
     template<typename T>
     void on_next(T&& v) const
     {
-        emplace(std::forward<T>(v));
+        std::unique_lock lock{disposable->mutex};
+        disposable->queue.emplace_back(std::forward<T>(v), disposable->worker.now() + disposable->delay);
+        schedule_if_needed(std::move(lock));
     }
 
     void on_error(const std::exception_ptr& err) const noexcept
     {
-        emplace(err);
+        std::unique_lock lock{disposable->mutex};
+        if constexpr (ClearOnError)
+        {
+            disposable->queue.clear();
+            if (disposable->is_emitting)
+            {
+                disposable->terminal            = err;
+                disposable->terminal_time_point = rpp::schedulers::time_point{};
+                disposable->is_error_pending.store(true, std::memory_order::relaxed);
+                return;
+            }
+
+            disposable->batch.clear();
+            disposable->observer.on_error(err);
+        }
+        else
+        {
+            disposable->terminal            = err;
+            disposable->terminal_time_point = disposable->worker.now() + disposable->delay;
+            schedule_if_needed(std::move(lock));
+        }
     }
 
     void on_completed() const noexcept
     {
-        emplace(rpp::utils::none{});
+        std::unique_lock lock{disposable->mutex};
+        disposable->terminal            = rpp::utils::none{};
+        disposable->terminal_time_point = disposable->worker.now() + disposable->delay;
+        schedule_if_needed(std::move(lock));
     }
 
 private:
-    template<typename TT>
-    void emplace(TT&& value) const
+    void schedule_if_needed(std::unique_lock<std::mutex> lock) const
     {
-        if (const auto delay = emplace_safe(std::forward<TT>(value)))
-        {
-            disposable->worker.schedule(
-                delay.value(),
-                [](const delay_disposable_wrapper<Observer, Worker, Container>& wrapper) { return drain_queue(wrapper.disposable); },
-                delay_disposable_wrapper<Observer, Worker, Container>{disposable});
-        }
+        if (std::exchange(disposable->is_active, true))
+            return;
+
+        lock.unlock();
+        disposable->worker.schedule(
+            disposable->delay,
+            [](const wrapper_t& wrapper) { return drain_queue(*wrapper.disposable); },
+            wrapper_t{disposable});
     }
 
-    template<typename TT>
-    std::optional<rpp::schedulers::duration> emplace_safe(TT&& item) const
+    static schedulers::optional_delay_to drain_queue(disposable_t& disposable)
     {
-        std::lock_guard lock{disposable->mutex};
-        if constexpr (ClearOnError && rpp::constraint::decayed_same_as<std::exception_ptr, TT>)
-        {
-            disposable->queue = std::queue<emission<rpp::utils::extract_observer_type_t<Observer>>>{};
-            disposable->observer.on_error(std::forward<TT>(item));
-            return std::nullopt;
-        }
-        else
+        auto now = disposable.worker.now();
+        while (true)
         {
-            disposable->queue.emplace(std::forward<TT>(item), disposable->worker.now() + disposable->delay);
-            if (!disposable->is_active)
+            if (ClearOnError || disposable.batch.empty())
             {
-                disposable->is_active = true;
-                return disposable->delay;
+                std::unique_lock lock{disposable.mutex};
+                if constexpr (ClearOnError)
+                {
+                    if (disposable.is_error_pending.load(std::memory_order::relaxed))
+                        disposable.batch.clear();
+                    disposable.is_emitting = true;
+                }
+
+                if (disposable.batch.empty())
+                {
+                    if (disposable.queue.empty())
+                        return drain_terminal(disposable, std::move(lock));
+
+                    disposable.batch.swap(disposable.queue);
+                }
             }
-            return std::nullopt;
+
+            do
+            {
+                if constexpr (ClearOnError)
+                {
+                    if (disposable.is_error_pending.load(std::memory_order::relaxed))
+                        break;
+                }
+
+                auto& top = disposable.batch.front();
+                if (top.time_point > now)
+                {
+                    now = disposable.worker.now();
+                    if (top.time_point > now)
+                    {
+                        if constexpr (ClearOnError)
+                        {
+                            std::lock_guard lock{disposable.mutex};
+                            if (disposable.is_error_pending.load(std::memory_order::relaxed))
+                                break;
+                            disposable.is_emitting = false;
+                        }
+                        return schedulers::optional_delay_to{top.time_point};
+                    }
+                }
+
+                auto value = std::move(top.value);
+                disposable.batch.pop_front();
+                disposable.observer.on_next(std::move(value));
+                disposable.demand.on_consumed();
+            } while (!disposable.batch.empty());
         }
     }
 
-    static schedulers::optional_delay_to drain_queue(const std::shared_ptr<delay_disposable<Observer, Worker, Container>>& disposable)
+    static schedulers::optional_delay_to drain_terminal(disposable_t& disposable, std::unique_lock<std::mutex> lock)
     {
-        while (true)
+        disposable.is_emitting = false;
+        if (std::holds_alternative<std::monostate>(disposable.terminal))
         {
-            std::unique_lock lock{disposable->mutex};
-            if (disposable->queue.empty())
-            {
-                disposable->is_active = false;
-                return std::nullopt;
-            }
+            disposable.is_active = false;
+            return std::nullopt;
+        }
 
-            auto&      top = disposable->queue.front();
-            if (top.time_point > disposable->worker.now())
-                return schedulers::optional_delay_to{top.time_point};
+        if (disposable.terminal_time_point > disposable.worker.now())
+            return schedulers::optional_delay_to{disposable.terminal_time_point};
 
-            auto item = std::move(top.value);
-            disposable->queue.pop();
-            lock.unlock();
+        const auto terminal = std::exchange(disposable.terminal, std::monostate{});
+        lock.unlock();
 
-            std::visit(rpp::utils::overloaded{[&](rpp::utils::extract_observer_type_t<Observer>&& v) { disposable->observer.on_next(std::move(v)); },
-                                              [&](const std::exception_ptr& err) { disposable->observer.on_error(err); },
-                                              [&](rpp::utils::none) {
-                                                  disposable->observer.on_completed();
-                                              }},
-                       std::move(item));
-        }
+        if (const auto err = std::get_if<std::exception_ptr>(&terminal))
+            disposable.observer.on_error(*err);
+        else
+            disposable.observer.on_completed();
+        return std::nullopt;
     }
 };
 
@@ -180,13 +258,26 @@ struct delay_t
 
     template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
     auto lift_with_disposable_strategy(Observer&& observer) const
+    {
+        return lift_impl<Type, DisposableStrategy, false>(std::forward<Observer>(observer));
+    }
+
+    template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
+    auto lift_with_requestable_upstream(Observer&& observer) const
+    {
+        return lift_impl<Type, DisposableStrategy, true>(std::forward<Observer>(observer));
+    }
+
+private:
+    template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, bool RequestableUpstream, rpp::constraint::observer Observer>
+    auto lift_impl(Observer&& observer) const
     {
         using worker_t = rpp::schedulers::utils::get_worker_t<Scheduler>;
         using container = typename DisposableStrategy::template add<worker_t::is_none_disposable ? 0 : 1>::disposable_container;
 
-        auto disposable = std::make_shared<delay_disposable<std::decay_t<Observer>, worker_t, container>>(std::forward<Observer>(observer), scheduler.create_worker(), duration);
+        auto disposable = std::make_shared<delay_disposable<std::decay_t<Observer>, worker_t, container, RequestableUpstream>>(std::forward<Observer>(observer), scheduler.create_worker(), duration);
         disposable->observer.set_upstream(rpp::disposable_wrapper::from_weak(disposable));
-        return rpp::observer<Type, delay_observer_strategy<std::decay_t<Observer>, worker_t, container, ClearOnError>>{std::move(disposable)};
+        return rpp::observer<Type, delay_observer_strategy<std::decay_t<Observer>, worker_t, container, ClearOnError, RequestableUpstream>>{std::move(disposable)};
     }
 };
 }
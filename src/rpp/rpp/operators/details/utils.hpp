@@ -10,10 +10,67 @@
 
 #pragma once
 
+#include <rpp/disposables/fwd.hpp>
+#include <rpp/observers/fwd.hpp>
+
+#include <rpp/disposables/disposable_wrapper.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
 #include <mutex>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 namespace rpp::operators::details
 {
+/**
+ * @brief Amount of items requested by queueing operators (like observe_on or merge) from backpressured observable in advance. Consumed items are requested again in batches.
+ */
+inline constexpr size_t backpressure_prefetch = 128;
+
+/**
+ * @brief Demand of queueing operator to its upstream. In case of backpressured upstream it requests `prefetch` items in advance and requests consumed items again in batches to not touch upstream for each item.
+ *
+ * @details Specialization for upstream which can't be backpressured (see rpp::details::observables::requestable_strategy) is empty and does nothing.
+ */
+template<bool RequestableUpstream>
+class upstream_demand
+{
+public:
+    void set_upstream(const rpp::disposable_wrapper& d, size_t prefetch)
+    {
+        if (auto requestable = d.dynamic_cast_to<rpp::interface_requestable_disposable>(); requestable.has_underlying())
+        {
+            m_upstream = std::move(requestable);
+            m_limit    = prefetch - prefetch / 4;
+            m_upstream.request(prefetch);
+        }
+    }
+
+    // expected to be called from one thread at a time
+    void on_consumed()
+    {
+        if (m_upstream.has_underlying() && ++m_consumed == m_limit)
+            m_upstream.request(std::exchange(m_consumed, 0));
+    }
+
+private:
+    rpp::requestable_disposable_wrapper m_upstream{};
+    size_t                              m_limit{};
+    size_t                              m_consumed{};
+};
+
+template<>
+class upstream_demand<false>
+{
+public:
+    static void set_upstream(const rpp::disposable_wrapper&, size_t) {}
+
+    static void on_consumed() {}
+};
+
 template<typename T>
 struct value_with_mutex
 {
@@ -56,4 +113,203 @@ private:
     T*                           m_ptr;
     std::scoped_lock<std::mutex> m_lock;
 };
+/**
+ * @brief Lock-free serialization of emissions via queue-drain ("emitter loop").
+ *
+ * @details Each emission increments counter of pending emissions. Thread which moves it from zero becomes owner: it passes its own emission to handler directly (without any allocation) and then drains queue of emissions submitted by other threads till counter goes back to zero. Other threads just push their emission into lock-free queue and return immediately, so, nobody ever blocks.
+ *
+ * Handler is called as `handler(std::in_place_index<I>, event)` where `I` is index of event's type inside of `Events`. Handler is always called serially.
+ */
+template<rpp::constraint::decayed_type... Events>
+class drain_loop
+{
+    using event_t = std::variant<Events...>;
+
+    struct node
+    {
+        event_t event;
+        node*   next{};
+    };
+
+public:
+    drain_loop() = default;
+
+    drain_loop(const drain_loop&) = delete;
+    drain_loop(drain_loop&&)      = delete;
+
+    ~drain_loop() noexcept
+    {
+        auto* head = m_head.exchange(nullptr, std::memory_order::acquire);
+        while (head)
+            delete std::exchange(head, head->next);
+    }
+
+    template<size_t I, typename Handler, typename Event>
+    void emit(const Handler& handler, Event&& event)
+    {
+        size_t expected{};
+        if (m_pending.compare_exchange_strong(expected, 1, std::memory_order::acquire, std::memory_order::relaxed))
+        {
+            handler(std::in_place_index<I>, std::forward<Event>(event));
+
+            // nobody submitted anything during our emission
+            expected = 1;
+            if (!m_pending.compare_exchange_strong(expected, 0, std::memory_order::release, std::memory_order::relaxed))
+                drain(handler);
+            return;
+        }
+
+        push(new node{event_t{std::in_place_index<I>, std::forward<Event>(event)}});
+        // previous owner could leave before our submission, so, our thread should drain
+        if (m_pending.fetch_add(1, std::memory_order::acq_rel) == 0)
+            drain(handler);
+    }
+
+private:
+    void push(node* n)
+    {
+        auto* head = m_head.load(std::memory_order::relaxed);
+        do
+        {
+            n->next = head;
+        } while (!m_head.compare_exchange_weak(head, n, std::memory_order::release, std::memory_order::relaxed));
+    }
+
+    template<typename Handler>
+    void drain(const Handler& handler)
+    {
+        // owner always accounts its own emission
+        size_t missed = 1;
+        while (true)
+        {
+            // stack keeps emissions in reversed order
+            node* reversed{};
+            auto* head = m_head.exchange(nullptr, std::memory_order::acquire);
+            while (head)
+            {
+                auto* next = std::exchange(head->next, reversed);
+                reversed   = std::exchange(head, next);
+            }
+
+            while (reversed)
+            {
+                dispatch(handler, std::move(reversed->event), std::index_sequence_for<Events...>{});
+                delete std::exchange(reversed, reversed->next);
+            }
+
+            missed = m_pending.fetch_sub(missed, std::memory_order::acq_rel) - missed;
+            if (missed == 0)
+                return;
+        }
+    }
+
+    template<typename Handler, size_t... I>
+    static void dispatch(const Handler& handler, event_t&& event, std::index_sequence<I...>)
+    {
+        ((event.index() == I ? handler(std::in_place_index<I>, std::move(std::get<I>(event))) : void()), ...);
+    }
+
+private:
+    std::atomic<node*>  m_head{};
+    std::atomic<size_t> m_pending{};
+};
+
+/**
+ * @brief Wrapper over observer to serialize its callbacks (called from multiple threads) via rpp::operators::details::drain_loop.
+ *
+ * @details Events submitted after on_error/on_completed are dropped.
+ * @details `WithAck` enables `on_next_with_ack` for backpressured upstreams, otherwise queued events don't have any space for it.
+ */
+template<rpp::constraint::observer TObserver, bool WithAck = false>
+class serialized_observer
+{
+    using Type = rpp::utils::extract_observer_type_t<TObserver>;
+
+    struct completed
+    {
+    };
+
+    struct acked_value
+    {
+        Type                                value;
+        rpp::requestable_disposable_wrapper upstream;
+    };
+
+    struct handler
+    {
+        serialized_observer* self;
+
+        template<typename T>
+        void operator()(std::in_place_index_t<0>, T&& v) const
+        {
+            if (!self->m_is_terminated)
+                self->m_observer.on_next(std::forward<T>(v));
+        }
+
+        void operator()(std::in_place_index_t<1>, const std::exception_ptr& err) const
+        {
+            if (!std::exchange(self->m_is_terminated, true))
+                self->m_observer.on_error(err);
+        }
+
+        void operator()(std::in_place_index_t<2>, completed) const
+        {
+            if (!std::exchange(self->m_is_terminated, true))
+                self->m_observer.on_completed();
+        }
+
+        void operator()(std::in_place_index_t<3>, acked_value&& v) const
+        {
+            if (self->m_is_terminated)
+                return;
+
+            self->m_observer.on_next(std::move(v.value));
+            v.upstream.request(1);
+        }
+    };
+
+public:
+    explicit serialized_observer(TObserver&& observer)
+        : m_observer{std::move(observer)}
+    {
+    }
+
+    /**
+     * @brief Expected to be called before any emission (during subscription)
+     */
+    void set_upstream(const rpp::disposable_wrapper& d) { m_observer.set_upstream(d); }
+
+    template<typename T>
+    void on_next(T&& v)
+    {
+        m_drain.template emit<0>(handler{this}, std::forward<T>(v));
+    }
+
+    /**
+     * @brief Same as on_next, but requests one more item from backpressured upstream once this value is passed to observer (even if it was queued)
+     */
+    template<typename T>
+    void on_next_with_ack(T&& v, const rpp::requestable_disposable_wrapper& upstream)
+        requires WithAck
+    {
+        m_drain.template emit<3>(handler{this}, acked_value{std::forward<T>(v), upstream});
+    }
+
+    void on_error(const std::exception_ptr& err)
+    {
+        m_drain.template emit<1>(handler{this}, err);
+    }
+
+    void on_completed()
+    {
+        m_drain.template emit<2>(handler{this}, completed{});
+    }
+
+private:
+    using drain_t = std::conditional_t<WithAck, drain_loop<Type, std::exception_ptr, completed, acked_value>, drain_loop<Type, std::exception_ptr, completed>>;
+
+    TObserver m_observer;
+    bool      m_is_terminated{};
+    drain_t   m_drain{};
+};
 } // namespace rpp::operators::details
\ No newline at end of file
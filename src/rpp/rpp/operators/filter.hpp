@@ -13,38 +13,52 @@
 #include <rpp/operators/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
+#include <memory>
 #include <type_traits>
 
 namespace rpp::operators::details
 {
-template<rpp::constraint::observer TObserver, rpp::constraint::decayed_type Fn>
+template<rpp::constraint::observer TObserver, rpp::constraint::decayed_type Fn, bool RequestableUpstream = false>
 struct filter_observer_strategy
 {
     using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
     RPP_NO_UNIQUE_ADDRESS TObserver observer;
     RPP_NO_UNIQUE_ADDRESS Fn        fn;
+    // dropped items are requested again to keep downstream's demand. Upstream keeps itself alive while emits, so, weak is enough
+    RPP_NO_UNIQUE_ADDRESS std::conditional_t<RequestableUpstream, std::weak_ptr<rpp::interface_requestable_disposable>, rpp::utils::none> upstream{};
 
     template<typename T>
     void on_next(T&& v) const
     {
         if (fn(rpp::utils::as_const(v)))
             observer.on_next(std::forward<T>(v));
+        else if constexpr (RequestableUpstream)
+        {
+            if (const auto locked = upstream.lock())
+                locked->request(1);
+        }
     }
 
     void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
 
     void on_completed() const { observer.on_completed(); }
 
-    void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
+    void set_upstream(const disposable_wrapper& d)
+    {
+        if constexpr (RequestableUpstream)
+            upstream = d.dynamic_cast_to<rpp::interface_requestable_disposable>().get_original();
+        observer.set_upstream(d);
+    }
 
     bool is_disposed() const { return observer.is_disposed(); }
 };
 
 template<rpp::constraint::decayed_type Fn>
-struct filter_t : public operators::details::operator_observable_strategy<filter_observer_strategy, Fn>
+struct filter_t
 {
     template<rpp::constraint::decayed_type T>
         requires std::is_invocable_r_v<bool, Fn, T>
@@ -52,6 +66,20 @@ struct filter_t : public operators::details::operator_observable_strategy<filter
 
     template<rpp::details::observables::constraint::disposable_strategy Prev>
     using updated_disposable_strategy = Prev;
+
+    RPP_NO_UNIQUE_ADDRESS Fn fn;
+
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer>
+    auto lift(Observer&& observer) const
+    {
+        return rpp::observer<Type, filter_observer_strategy<std::decay_t<Observer>, Fn>>{std::forward<Observer>(observer), fn};
+    }
+
+    template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
+    auto lift_with_requestable_upstream(Observer&& observer) const
+    {
+        return rpp::observer<Type, filter_observer_strategy<std::decay_t<Observer>, Fn, true>>{std::forward<Observer>(observer), fn};
+    }
 };
 }
 
@@ -17,10 +17,11 @@
 namespace rpp::operators::details
 {
 
-template<rpp::constraint::decayed_type Fn>
+template<rpp::constraint::decayed_type Fn, rpp::constraint::decayed_type TMerge = merge_t>
 struct flat_map_t
 {
-    RPP_NO_UNIQUE_ADDRESS Fn m_fn;
+    RPP_NO_UNIQUE_ADDRESS Fn     m_fn;
+    RPP_NO_UNIQUE_ADDRESS TMerge m_merge{};
 
     template<rpp::constraint::observable TObservable>
         requires (std::invocable<Fn, rpp::utils::extract_observable_type_t<TObservable>>
@@ -29,7 +30,7 @@ struct flat_map_t
     {
         return std::forward<TObservable>(observable)
              | rpp::ops::map(m_fn)
-             | rpp::ops::merge();
+             | m_merge;
     }
 
     template<rpp::constraint::observable TObservable>
@@ -39,7 +40,7 @@ struct flat_map_t
     {
         return std::forward<TObservable>(observable)
              | rpp::ops::map(std::move(m_fn))
-             | rpp::ops::merge();
+             | std::move(m_merge);
     }
 };
 
@@ -73,4 +74,29 @@ auto flat_map(Fn&& callable)
     return details::flat_map_t<std::decay_t<Fn>>{std::forward<Fn>(callable)};
 }
 
+/**
+ * @brief Transform the items emitted by an Observable into Observables, then flatten the emissions from those into a single Observable, but keep at most `max_concurrent` of those Observables subscribed at the same time
+ *
+ * @marble flat_map_max_concurrent
+        {
+            source observable                      : +--1--2--3--|
+            operator "flat_map(x=>just(x,x+1), 2)" : +--12-23-34-|
+        }
+ *
+ * @details Actually it makes `map(callable)` and then `merge(max_concurrent)`: Observables obtained while `max_concurrent` of them are active are buffered and subscribed in order of arrival once any active one completes.
+ *
+ * @param callable function that returns an observable for each item emitted by the source observable.
+ * @param max_concurrent maximum number of simultaneously subscribed observables returned by `callable` (at least 1)
+ * @warning #include <rpp/operators/flat_map.hpp>
+ *
+ * @ingroup transforming_operators
+ * @see https://reactivex.io/documentation/operators/flatmap.html
+ */
+template<typename Fn>
+    requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+auto flat_map(Fn&& callable, size_t max_concurrent)
+{
+    return details::flat_map_t<std::decay_t<Fn>, details::merge_concurrent_t>{std::forward<Fn>(callable), details::merge_concurrent_t{max_concurrent}};
+}
+
 } // namespace rpp::operators
@@ -31,6 +31,10 @@ auto combine_latest(TSelector&& selector, TObservable&& observable, TObservables
 template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
 auto combine_latest(TObservable&& observable, TObservables&&... observables);
 
+template<typename Fn>
+    requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+auto concat_map(Fn&& callable);
+
 template<rpp::schedulers::constraint::scheduler Scheduler>
 auto debounce(rpp::schedulers::duration period, Scheduler&& scheduler);
 
@@ -74,14 +78,35 @@ template<typename Fn>
     requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
 auto flat_map(Fn&& callable);
 
+template<typename Fn>
+    requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+auto flat_map(Fn&& callable, size_t max_concurrent);
+
 template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
     requires constraint::observables_of_same_type<std::decay_t<TObservable>, std::decay_t<TObservables>...>
 auto merge_with(TObservable&& observable, TObservables&&... observables);
 auto merge();
+auto merge(size_t max_concurrent);
 
 template<rpp::schedulers::constraint::scheduler Scheduler>
 auto observe_on(Scheduler&& scheduler, rpp::schedulers::duration delay_duration = {});
 
+/**
+ * @brief Action applied by bounded rpp::operators::observe_on to new item when its queue is full
+ *
+ * @ingroup utility_operators
+ */
+enum class overflow_policy
+{
+    drop_oldest,
+    drop_newest,
+    block_producer,
+    error
+};
+
+template<rpp::schedulers::constraint::scheduler Scheduler>
+auto observe_on(Scheduler&& scheduler, size_t capacity, overflow_policy policy);
+
 auto publish();
 
 auto ref_count();
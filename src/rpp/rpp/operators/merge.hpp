@@ -14,21 +14,29 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/operators/details/utils.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/utils/ring_buffer.hpp>
 #include <rpp/utils/tuple.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
-#include <mutex>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
 
 namespace rpp::operators::details
 {
-template<rpp::constraint::observer TObserver>
-class merge_disposable final : public composite_disposable
+template<rpp::constraint::observer TObserver, bool RequestableUpstream>
+class merge_disposable final : public composite_disposable_impl<rpp::details::disposables::slot_map_disposables_container>
 {
 public:
+    static constexpr bool is_requestable_upstream = RequestableUpstream;
+
     merge_disposable(TObserver&& observer)
         : m_observer(std::move(observer))
     {
@@ -40,22 +48,22 @@ public:
     // just need atomicity, not guarding anything
     bool decrement_on_completed() { return m_on_completed_needed.fetch_sub(1, std::memory_order::relaxed) == 1; }
 
-    pointer_under_lock<TObserver> get_observer_under_lock() { return pointer_under_lock{m_observer}; }
+    serialized_observer<TObserver, RequestableUpstream>& get_observer() { return m_observer; }
 
 private:
-    value_with_mutex<TObserver> m_observer{};
-    std::atomic_size_t          m_on_completed_needed{1};
+    serialized_observer<TObserver, RequestableUpstream> m_observer;
+    std::atomic_size_t                                  m_on_completed_needed{1};
 };
 
-template<rpp::constraint::observer TObserver>
+template<typename TDisposable>
 struct merge_observer_base_strategy
 {
-    merge_observer_base_strategy(std::shared_ptr<merge_disposable<TObserver>>&& disposable)
+    merge_observer_base_strategy(std::shared_ptr<TDisposable>&& disposable)
         : m_disposable{std::move(disposable)}
     {
     }
 
-    merge_observer_base_strategy(const std::shared_ptr<merge_disposable<TObserver>>& disposable)
+    merge_observer_base_strategy(const std::shared_ptr<TDisposable>& disposable)
         : m_disposable{disposable}
     {
     }
@@ -73,7 +81,7 @@ struct merge_observer_base_strategy
     void on_error(const std::exception_ptr& err) const
     {
         m_disposable->dispose();
-        m_disposable->get_observer_under_lock()->on_error(err);
+        m_disposable->get_observer().on_error(err);
     }
 
     void on_completed() const
@@ -81,41 +89,359 @@ struct merge_observer_base_strategy
         if (m_disposable->decrement_on_completed())
         {
             m_disposable->dispose();
-            m_disposable->get_observer_under_lock()->on_completed();
+            m_disposable->get_observer().on_completed();
         }
     }
 
 protected:
-    std::shared_ptr<merge_disposable<TObserver>> m_disposable;
+    std::shared_ptr<TDisposable> m_disposable;
 };
 
+/**
+ * @brief Forwards emissions of inner observable to serialized observer.
+ *
+ * @details Upstream of inner observable is erased from merge's disposables as soon as inner observable completes, so, long-living merge of many short inner observables keeps only alive ones.
+ * @details In case of backpressured inner observable (possible only if any of inner observables is rpp::constraint::requestable_observable) it requests only limited amount of items in advance and each next item is requested only once previous one is passed to observer, so, amount of items queued by serialized observer is limited too.
+ */
+template<typename TDisposable>
+struct merge_observer_inner_base_strategy : public merge_observer_base_strategy<TDisposable>
+{
+    using base = merge_observer_base_strategy<TDisposable>;
+    using base::base;
+
+    void set_upstream(const rpp::disposable_wrapper& d)
+    {
+        if (!m_upstream_handle)
+            m_upstream_handle = base::m_disposable->insert(d);
+        else
+            base::set_upstream(d);
+
+        if constexpr (TDisposable::is_requestable_upstream)
+        {
+            if (auto requestable = d.dynamic_cast_to<rpp::interface_requestable_disposable>(); requestable.has_underlying())
+            {
+                m_upstream = std::move(requestable);
+                m_upstream.request(backpressure_prefetch);
+            }
+        }
+    }
+
+    template<typename T>
+    void on_next(T&& v) const
+    {
+        if constexpr (TDisposable::is_requestable_upstream)
+        {
+            if (m_upstream.has_underlying())
+                return base::m_disposable->get_observer().on_next_with_ack(std::forward<T>(v), m_upstream);
+        }
+        base::m_disposable->get_observer().on_next(std::forward<T>(v));
+    }
+
+    void on_completed() const
+    {
+        erase_upstream();
+        base::on_completed();
+    }
+
+protected:
+    void erase_upstream() const
+    {
+        if (m_upstream_handle)
+            base::m_disposable->erase(m_upstream_handle.value());
+    }
+
+private:
+    using upstream_t = std::conditional_t<TDisposable::is_requestable_upstream, rpp::requestable_disposable_wrapper, rpp::utils::none>;
+
+    RPP_NO_UNIQUE_ADDRESS upstream_t                                                 m_upstream{};
+    std::optional<rpp::details::disposables::slot_map_disposables_container::handle> m_upstream_handle{};
+};
+
+template<rpp::constraint::observer TObserver, bool RequestableUpstream>
+struct merge_observer_inner_strategy final : public merge_observer_inner_base_strategy<merge_disposable<TObserver, RequestableUpstream>>
+{
+    using base = merge_observer_inner_base_strategy<merge_disposable<TObserver, RequestableUpstream>>;
+    using base::base;
+};
+
+template<rpp::constraint::observer TObserver, bool RequestableUpstream>
+class merge_observer_strategy final : public merge_observer_base_strategy<merge_disposable<TObserver, RequestableUpstream>>
+{
+    using base           = merge_observer_base_strategy<merge_disposable<TObserver, RequestableUpstream>>;
+    using inner_strategy = merge_observer_inner_strategy<TObserver, RequestableUpstream>;
+
+public:
+    explicit merge_observer_strategy(TObserver&& observer)
+        : base{std::make_shared<merge_disposable<TObserver, RequestableUpstream>>(std::move(observer))}
+    {
+        base::m_disposable->get_observer().set_upstream(disposable_wrapper::from_weak(base::m_disposable));
+    }
+
+    template<typename T>
+    void on_next(T&& v) const
+    {
+        base::m_disposable->increment_on_completed();
+        std::forward<T>(v).subscribe(rpp::observer<rpp::utils::extract_observer_type_t<TObserver>, inner_strategy>{inner_strategy{base::m_disposable}});
+    }
+};
+
+/**
+ * @brief State of merge where all observables are synchronous (see rpp::constraint::synchronous_observable). All emissions happen in the subscribing thread right during subscription, so, state is kept on stack of `subscribe` and has no any locks or atomics.
+ */
 template<rpp::constraint::observer TObserver>
-struct merge_observer_inner_strategy final : public merge_observer_base_strategy<TObserver>
+class merge_synchronous_state
 {
-    using merge_observer_base_strategy<TObserver>::merge_observer_base_strategy;
+public:
+    merge_synchronous_state(TObserver&& observer, size_t on_completed_needed)
+        : m_observer{std::move(observer)}
+        , m_on_completed_needed{on_completed_needed}
+    {
+    }
+
+    merge_synchronous_state(const merge_synchronous_state&) = delete;
+    merge_synchronous_state(merge_synchronous_state&&)      = delete;
+
+    void increment_on_completed() { ++m_on_completed_needed; }
+
+    TObserver& get_observer() { return m_observer; }
+
+    bool is_disposed() const { return m_is_terminated || m_observer.is_disposed(); }
+
+    void on_error(const std::exception_ptr& err)
+    {
+        if (!std::exchange(m_is_terminated, true))
+            m_observer.on_error(err);
+    }
+
+    void on_completed()
+    {
+        if (--m_on_completed_needed == 0 && !std::exchange(m_is_terminated, true))
+            m_observer.on_completed();
+    }
+
+private:
+    TObserver m_observer;
+    size_t    m_on_completed_needed;
+    bool      m_is_terminated{};
+};
+
+template<rpp::constraint::observer TObserver>
+struct merge_synchronous_inner_strategy
+{
+    merge_synchronous_state<TObserver>* state;
+
+    void set_upstream(const rpp::disposable_wrapper& d) const { state->get_observer().set_upstream(d); }
+
+    bool is_disposed() const { return state->is_disposed(); }
 
     template<typename T>
     void on_next(T&& v) const
     {
-        merge_observer_base_strategy<TObserver>::m_disposable->get_observer_under_lock()->on_next(std::forward<T>(v));
+        state->get_observer().on_next(std::forward<T>(v));
     }
+
+    void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+    void on_completed() const { state->on_completed(); }
 };
 
 template<rpp::constraint::observer TObserver>
-class merge_observer_strategy final : public merge_observer_base_strategy<TObserver>
+struct merge_synchronous_observer_strategy
+{
+    merge_synchronous_state<TObserver>* state;
+
+    void set_upstream(const rpp::disposable_wrapper& d) const { state->get_observer().set_upstream(d); }
+
+    bool is_disposed() const { return state->is_disposed(); }
+
+    template<typename T>
+    void on_next(T&& v) const
+    {
+        state->increment_on_completed();
+        std::forward<T>(v).subscribe(rpp::observer<rpp::utils::extract_observer_type_t<TObserver>, merge_synchronous_inner_strategy<TObserver>>{state});
+    }
+
+    void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+    void on_completed() const { state->on_completed(); }
+};
+
+template<rpp::constraint::observer TObserver, rpp::constraint::observable TInnerObservable>
+struct merge_concurrent_inner_strategy;
+
+/**
+ * @brief State of merge with limited number of concurrently subscribed inner observables.
+ *
+ * @details Inner observables exceeding the limit are buffered and subscribed once any active inner observable completes. Buffer and counters are touched only from inside of drain_loop, so, no mutex is needed: new inner observables and completions coming from different threads are just serialized by it. The only exception is completion of inner observable right during subscription to it: such a completion is detected via id of subscribing observable and handled after subscription by the same thread.
+ */
+template<rpp::constraint::observer TObserver, rpp::constraint::observable TInnerObservable>
+class merge_concurrent_disposable final : public composite_disposable_impl<rpp::details::disposables::slot_map_disposables_container>
+    , public std::enable_shared_from_this<merge_concurrent_disposable<TObserver, TInnerObservable>>
 {
+    struct inner_completed
+    {
+    };
+
+    struct outer_completed
+    {
+    };
+
+    struct handler
+    {
+        merge_concurrent_disposable* self;
+
+        void operator()(std::in_place_index_t<0>, TInnerObservable observable) const
+        {
+            if (self->is_disposed())
+                return;
+
+            if (self->m_active == self->m_max_concurrent)
+            {
+                self->m_pending.push_back(std::move(observable));
+                return;
+            }
+
+            ++self->m_active;
+            if (self->subscribe_inner(observable))
+                self->on_slot_freed();
+        }
+
+        void operator()(std::in_place_index_t<1>, inner_completed) const
+        {
+            if (!self->is_disposed())
+                self->on_slot_freed();
+        }
+
+        void operator()(std::in_place_index_t<2>, outer_completed) const
+        {
+            self->m_outer_completed = true;
+            self->complete_if_finished();
+        }
+    };
+
 public:
-    explicit merge_observer_strategy(TObserver&& observer)
-        : merge_observer_base_strategy<TObserver>{std::make_shared<merge_disposable<TObserver>>(std::move(observer))}
+    static constexpr bool is_requestable_upstream = rpp::constraint::requestable_observable<TInnerObservable>;
+
+    merge_concurrent_disposable(TObserver&& observer, size_t max_concurrent)
+        : m_observer(std::move(observer))
+        , m_max_concurrent{std::max(size_t{1}, max_concurrent)}
+    {
+    }
+
+    template<typename T>
+    void on_outer_next(T&& observable)
+    {
+        m_control.template emit<0>(handler{this}, std::forward<T>(observable));
+    }
+
+    void on_outer_completed() { m_control.template emit<2>(handler{this}, outer_completed{}); }
+
+    void on_inner_completed(size_t inner_id)
+    {
+        // completion during subscription is handled by subscribing thread itself without queueing of event
+        if (size_t expected = inner_id; m_subscribing_inner_id.compare_exchange_strong(expected, 0, std::memory_order::acq_rel, std::memory_order::relaxed))
+            return;
+
+        m_control.template emit<1>(handler{this}, inner_completed{});
+    }
+
+    serialized_observer<TObserver, is_requestable_upstream>& get_observer() { return m_observer; }
+
+private:
+    /**
+     * @return true if inner observable completed synchronously during subscription
+     */
+    bool subscribe_inner(const TInnerObservable& observable)
+    {
+        const size_t id = ++m_last_inner_id;
+        m_subscribing_inner_id.store(id, std::memory_order::release);
+
+        observable.subscribe(rpp::observer<rpp::utils::extract_observer_type_t<TObserver>, merge_concurrent_inner_strategy<TObserver, TInnerObservable>>{this->shared_from_this(), id});
+
+        size_t expected = id;
+        return !m_subscribing_inner_id.compare_exchange_strong(expected, 0, std::memory_order::acq_rel, std::memory_order::acquire);
+    }
+
+    void on_slot_freed()
+    {
+        // slot is passed to next buffered observable as is. Synchronously completed ones are handled iteratively, not recursively
+        while (!m_pending.empty())
+        {
+            if (is_disposed())
+                return;
+
+            const auto observable = std::move(m_pending.front());
+            m_pending.pop_front();
+            if (!subscribe_inner(observable))
+                return;
+        }
+
+        --m_active;
+        complete_if_finished();
+    }
+
+    void complete_if_finished()
+    {
+        if (m_active != 0 || !m_outer_completed)
+            return;
+
+        dispose();
+        m_observer.on_completed();
+    }
+
+private:
+    serialized_observer<TObserver, is_requestable_upstream>        m_observer;
+    drain_loop<TInnerObservable, inner_completed, outer_completed> m_control{};
+    std::atomic_size_t                                             m_subscribing_inner_id{};
+    rpp::utils::ring_buffer<TInnerObservable>                      m_pending{};
+    const size_t                                                   m_max_concurrent;
+    size_t                                                         m_active{};
+    size_t                                                         m_last_inner_id{};
+    bool                                                           m_outer_completed{};
+};
+
+template<rpp::constraint::observer TObserver, rpp::constraint::observable TInnerObservable>
+struct merge_concurrent_inner_strategy final : public merge_observer_inner_base_strategy<merge_concurrent_disposable<TObserver, TInnerObservable>>
+{
+    using base = merge_observer_inner_base_strategy<merge_concurrent_disposable<TObserver, TInnerObservable>>;
+
+    merge_concurrent_inner_strategy(std::shared_ptr<merge_concurrent_disposable<TObserver, TInnerObservable>>&& disposable, size_t id)
+        : base{std::move(disposable)}
+        , m_id{id}
+    {
+    }
+
+    void on_completed() const
     {
-        merge_observer_base_strategy<TObserver>::m_disposable->get_observer_under_lock()->set_upstream(disposable_wrapper::from_weak(merge_observer_base_strategy<TObserver>::m_disposable));
+        base::erase_upstream();
+        base::m_disposable->on_inner_completed(m_id);
+    }
+
+private:
+    size_t m_id;
+};
+
+template<rpp::constraint::observer TObserver, rpp::constraint::observable TInnerObservable>
+class merge_concurrent_observer_strategy final : public merge_observer_base_strategy<merge_concurrent_disposable<TObserver, TInnerObservable>>
+{
+    using base = merge_observer_base_strategy<merge_concurrent_disposable<TObserver, TInnerObservable>>;
+
+public:
+    merge_concurrent_observer_strategy(TObserver&& observer, size_t max_concurrent)
+        : base{std::make_shared<merge_concurrent_disposable<TObserver, TInnerObservable>>(std::move(observer), max_concurrent)}
+    {
+        base::m_disposable->get_observer().set_upstream(disposable_wrapper::from_weak(base::m_disposable));
     }
 
     template<typename T>
     void on_next(T&& v) const
     {
-        merge_observer_base_strategy<TObserver>::m_disposable->increment_on_completed();
-        std::forward<T>(v).subscribe(rpp::observer<rpp::utils::extract_observer_type_t<TObserver>, merge_observer_inner_strategy<TObserver>>{merge_observer_inner_strategy<TObserver>{merge_observer_base_strategy<TObserver>::m_disposable}});
+        base::m_disposable->on_outer_next(std::forward<T>(v));
+    }
+
+    void on_completed() const
+    {
+        base::m_disposable->on_outer_completed();
     }
 };
 
@@ -131,12 +457,50 @@ struct merge_t
     template<rpp::constraint::observer Observer, typename... Strategies>
     void subscribe(Observer&& observer, const observable_chain_strategy<Strategies...>& strategy) const
     {
-        // Need to take ownership over current_thread in case of inner-observables also uses them
-        auto drain_on_exit = rpp::schedulers::current_thread::own_queue_and_drain_finally_if_not_owned();
+        using InnerObservable = typename observable_chain_strategy<Strategies...>::value_type;
+
+        if constexpr (rpp::details::observables::synchronous_strategy<observable_chain_strategy<Strategies...>> && rpp::constraint::synchronous_observable<InnerObservable>)
+        {
+            merge_synchronous_state<std::decay_t<Observer>> state{std::forward<Observer>(observer), 1};
+            strategy.subscribe(rpp::observer<InnerObservable, merge_synchronous_observer_strategy<std::decay_t<Observer>>>{&state});
+        }
+        else
+        {
+            // Need to take ownership over current_thread in case of inner-observables also uses them
+            auto drain_on_exit = rpp::schedulers::current_thread::own_queue_and_drain_finally_if_not_owned();
+
+            using merge_strategy = merge_observer_strategy<std::decay_t<Observer>, rpp::constraint::requestable_observable<InnerObservable>>;
+            strategy.subscribe(rpp::observer<InnerObservable, merge_strategy>{std::forward<Observer>(observer)});
+        }
+    }
+};
+
+struct merge_concurrent_t
+{
+    size_t max_concurrent;
 
+    template<rpp::constraint::decayed_type T>
+        requires rpp::constraint::observable<T>
+    using result_value = rpp::utils::extract_observable_type_t<T>;
+
+    template<rpp::details::observables::constraint::disposable_strategy Prev>
+    using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+    template<rpp::constraint::observer Observer, typename... Strategies>
+    void subscribe(Observer&& observer, const observable_chain_strategy<Strategies...>& strategy) const
+    {
         using InnerObservable = typename observable_chain_strategy<Strategies...>::value_type;
 
-        strategy.subscribe(rpp::observer<InnerObservable, merge_observer_strategy<std::decay_t<Observer>>>{std::forward<Observer>(observer)});
+        // synchronous inner observable completes before next one is obtained, so, limit is satisfied automatically
+        if constexpr (rpp::details::observables::synchronous_strategy<observable_chain_strategy<Strategies...>> && rpp::constraint::synchronous_observable<InnerObservable>)
+            merge_t{}.subscribe(std::forward<Observer>(observer), strategy);
+        else
+        {
+            // Need to take ownership over current_thread in case of inner-observables also uses them
+            auto drain_on_exit = rpp::schedulers::current_thread::own_queue_and_drain_finally_if_not_owned();
+
+            strategy.subscribe(rpp::observer<InnerObservable, merge_concurrent_observer_strategy<std::decay_t<Observer>, InnerObservable>>{std::forward<Observer>(observer), max_concurrent});
+        }
     }
 };
 
@@ -155,19 +519,32 @@ struct merge_with_t
     template<rpp::constraint::observer Observer, typename... Strategies>
     void subscribe(Observer&& observer, const observable_chain_strategy<Strategies...>& observable_strategy) const
     {
-        merge_observer_strategy<std::decay_t<Observer>> strategy{std::forward<Observer>(observer)};
+        if constexpr (rpp::details::observables::synchronous_strategy<observable_chain_strategy<Strategies...>> && (rpp::constraint::synchronous_observable<TObservables> && ...))
+        {
+            merge_synchronous_state<std::decay_t<Observer>> state{std::forward<Observer>(observer), 1};
+            merge_synchronous_observer_strategy<std::decay_t<Observer>> strategy{&state};
+
+            strategy.on_next(observable_strategy);
+            observables.apply(&apply<merge_synchronous_observer_strategy<std::decay_t<Observer>>>, strategy);
+            strategy.on_completed();
+        }
+        else
+        {
+            using merge_strategy = merge_observer_strategy<std::decay_t<Observer>, rpp::details::observables::requestable_strategy<observable_chain_strategy<Strategies...>> || (rpp::constraint::requestable_observable<TObservables> || ...)>;
+            merge_strategy strategy{std::forward<Observer>(observer)};
 
-        // Need to take ownership over current_thread in case of inner-observables also uses them
-        auto drain_on_exit = rpp::schedulers::current_thread::own_queue_and_drain_finally_if_not_owned();
+            // Need to take ownership over current_thread in case of inner-observables also uses them
+            auto drain_on_exit = rpp::schedulers::current_thread::own_queue_and_drain_finally_if_not_owned();
 
-        strategy.on_next(observable_strategy);
-        observables.apply(&apply<std::decay_t<Observer>>, strategy);
-        strategy.on_completed();
+            strategy.on_next(observable_strategy);
+            observables.apply(&apply<merge_strategy>, strategy);
+            strategy.on_completed();
+        }
     }
 
 private:
-    template<rpp::constraint::observer Observer>
-    static void apply(const merge_observer_strategy<Observer>& strategy, const TObservables&... observables)
+    template<typename Strategy>
+    static void apply(const Strategy& strategy, const TObservables&... observables)
     {
         (strategy.on_next(observables), ...);
     }
@@ -179,7 +556,7 @@ namespace rpp::operators
 /**
  * @brief Converts observable of observables of items into observable of items via merging emissions.
  *
- * @warning According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable uses mutex to satisfy this requirement
+ * @warning According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable serializes emissions via lock-free queue-drain to satisfy this requirement
  *
  * @warning During on subscribe operator takes ownership over rpp::schedulers::current_thread to allow mixing of underlying emissions
  *
@@ -197,7 +574,8 @@ namespace rpp::operators
  *
  * @par Performance notes:
  * - 2 heap allocation (1 for state, 1 to convert observer to dynamic_observer)
- * - Acquiring mutex during all observer's calls
+ * - No locks during observer's calls: emission without contention is passed to observer directly, concurrent emissions are queued (1 heap allocation per queued emission) and passed to observer by thread which is emitting right now
+ * - If source observable and inner observables are synchronous (for example, `just` with rpp::schedulers::immediate): no heap allocations, no locks and no atomics at all, rpp::schedulers::current_thread is not touched
  *
  * @warning #include <rpp/operators/merge.hpp>
  *
@@ -212,10 +590,46 @@ inline auto merge()
     return details::merge_t{};
 }
 
+/**
+ * @brief Converts observable of observables of items into observable of items via merging emissions, but keeps at most `max_concurrent` inner observables subscribed at the same time.
+ *
+ * @warning According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable serializes emissions via lock-free queue-drain to satisfy this requirement
+ *
+ * @warning During on subscribe operator takes ownership over rpp::schedulers::current_thread to allow mixing of underlying emissions
+ *
+ * @marble merge_max_concurrent
+     {
+         source observable                :
+         {
+             +--1-2-3-|
+             .....+4--6-|
+         }
+         operator "merge(1)" : +--1-2-3-4--6-|
+     }
+ *
+ * @details Inner observables emitted while `max_concurrent` of them are already subscribed are buffered and subscribed in order of arrival as soon as any active inner observable completes. Resulting observables completes when source and ALL observables completes
+ * @details `merge(1)` subscribes to inner observables one by one, exactly as rpp::operators::concat_map does.
+ *
+ * @par Performance notes:
+ * - 2 heap allocation (1 for state, 1 to convert observer to dynamic_observer)
+ * - No locks at all: buffering of inner observables and their completions are serialized via the same lock-free queue-drain as emissions
+ * - Inner observable completed during subscription to it frees its slot without any allocations, completion concurrent with other events is queued (1 heap allocation)
+ *
+ * @param max_concurrent maximum number of inner observables subscribed at the same time (at least 1)
+ * @warning #include <rpp/operators/merge.hpp>
+ *
+ * @ingroup combining_operators
+ * @see https://reactivex.io/documentation/operators/merge.html
+ */
+inline auto merge(size_t max_concurrent)
+{
+    return details::merge_concurrent_t{max_concurrent};
+}
+
 /**
  * @brief Combines submissions from current observable with other observables into one
  *
- * @warning According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable uses mutex to satisfy this requirement
+ * @warning According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable serializes emissions via lock-free queue-drain to satisfy this requirement
  *
  * @warning During on subscribe operator takes ownership over rpp::schedulers::current_thread to allow mixing of underlying emissions
  *
@@ -230,7 +644,8 @@ inline auto merge()
  *
  * @par Performance notes:
  * - 2 heap allocation (1 for state, 1 to convert observer to dynamic_observer)
- * - Acquiring mutex during all observer's calls
+ * - No locks during observer's calls: emission without contention is passed to observer directly, concurrent emissions are queued (1 heap allocation per queued emission) and passed to observer by thread which is emitting right now
+ * - If all observables are synchronous (for example, `just` with rpp::schedulers::immediate) merge_with works like concat: no heap allocations, no locks and no atomics at all
  *
  * @param observables are observables whose emissions would be merged with current observable
  * @warning #include <rpp/operators/merge.hpp>
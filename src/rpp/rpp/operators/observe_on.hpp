@@ -11,7 +11,263 @@
 #pragma once
 
 #include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/operators/delay.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/exceptions.hpp>
+#include <rpp/utils/ring_buffer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace rpp::operators::details
+{
+/**
+ * @brief State of observe_on with bounded queue: items are kept in fixed-size ring buffer, terminal events are kept out of band.
+ */
+template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, bool RequestableUpstream>
+struct bounded_observe_on_disposable final : public rpp::composite_disposable_impl<Container>
+{
+    using T = rpp::utils::extract_observer_type_t<Observer>;
+
+    bounded_observe_on_disposable(Observer&& in_observer, Worker&& in_worker, size_t in_capacity, overflow_policy in_policy, std::shared_ptr<std::atomic_size_t> in_dropped)
+        : observer(std::move(in_observer))
+        , worker{std::move(in_worker)}
+        , capacity{std::max(size_t{1}, in_capacity)}
+        , policy{in_policy}
+        , dropped{std::move(in_dropped)}
+        , queue{capacity}
+    {
+        if constexpr (!Worker::is_none_disposable)
+        {
+            if (auto d = worker.get_disposable(); !d.is_disposed())
+                rpp::composite_disposable_impl<Container>::add(std::move(d));
+        }
+    }
+
+    Observer                                  observer;
+    RPP_NO_UNIQUE_ADDRESS Worker              worker;
+    const size_t                              capacity;
+    const overflow_policy                     policy;
+    const std::shared_ptr<std::atomic_size_t> dropped;
+
+    std::mutex                 mutex{};
+    std::condition_variable    has_space{};
+    rpp::utils::ring_buffer<T> queue;
+    std::exception_ptr         error{};
+    bool                       is_completed{};
+    bool                       is_active{};
+    std::atomic_bool           is_terminated{};
+
+    // backpressured upstream is requested for capacity of queue, so, queue never overflows. Accessed only by draining thread after set_upstream
+    RPP_NO_UNIQUE_ADDRESS upstream_demand<RequestableUpstream> demand{};
+
+private:
+    void dispose_impl() noexcept override
+    {
+        {
+            // producer could check predicate right now, so, lock is needed to not miss notification
+            std::lock_guard lock{mutex};
+        }
+        has_space.notify_all();
+    }
+};
+
+template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, bool RequestableUpstream>
+struct bounded_observe_on_disposable_wrapper
+{
+    std::shared_ptr<bounded_observe_on_disposable<Observer, Worker, Container, RequestableUpstream>> disposable{};
+
+    bool is_disposed() const { return disposable->is_disposed(); }
+
+    void on_error(const std::exception_ptr& err) const { disposable->observer.on_error(err); }
+};
+
+template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, bool RequestableUpstream>
+struct bounded_observe_on_observer_strategy
+{
+    using disposable_t = bounded_observe_on_disposable<Observer, Worker, Container, RequestableUpstream>;
+    using wrapper_t    = bounded_observe_on_disposable_wrapper<Observer, Worker, Container, RequestableUpstream>;
+
+    std::shared_ptr<disposable_t> disposable{};
+
+    void set_upstream(const rpp::disposable_wrapper& d) const
+    {
+        disposable->add(d);
+        disposable->demand.set_upstream(d, disposable->capacity);
+    }
+
+    bool is_disposed() const
+    {
+        // just need atomicity, not guarding anything
+        return disposable->is_disposed() || disposable->is_terminated.load(std::memory_order::relaxed);
+    }
+
+    template<typename T>
+    void on_next(T&& v) const
+    {
+        std::unique_lock lock{disposable->mutex};
+        if (disposable->is_terminated.load(std::memory_order::relaxed))
+            return;
+
+        if (disposable->queue.size() == disposable->capacity)
+        {
+            switch (disposable->policy)
+            {
+                case overflow_policy::drop_oldest:
+                    disposable->queue.pop_front();
+                    disposable->dropped->fetch_add(1, std::memory_order::relaxed);
+                    break;
+                case overflow_policy::drop_newest:
+                    disposable->dropped->fetch_add(1, std::memory_order::relaxed);
+                    return;
+                case overflow_policy::block_producer:
+                    disposable->has_space.wait(lock, [&] { return disposable->queue.size() < disposable->capacity || disposable->is_disposed() || disposable->is_terminated.load(std::memory_order::relaxed); });
+                    if (disposable->queue.size() == disposable->capacity || disposable->is_terminated.load(std::memory_order::relaxed))
+                        return;
+                    break;
+                case overflow_policy::error:
+                    // new item and all queued ones are never emitted
+                    disposable->dropped->fetch_add(disposable->queue.size() + 1, std::memory_order::relaxed);
+                    terminate(std::move(lock), std::make_exception_ptr(rpp::utils::queue_overflow{"observe_on queue overflow"}));
+                    return;
+            }
+        }
+
+        disposable->queue.emplace_back(std::forward<T>(v));
+        schedule_if_needed(std::move(lock));
+    }
+
+    void on_error(const std::exception_ptr& err) const
+    {
+        std::unique_lock lock{disposable->mutex};
+        if (!disposable->is_terminated.load(std::memory_order::relaxed))
+            terminate(std::move(lock), err);
+    }
+
+    void on_completed() const
+    {
+        std::unique_lock lock{disposable->mutex};
+        if (disposable->is_terminated.exchange(true, std::memory_order::relaxed))
+            return;
+
+        disposable->is_completed = true;
+        schedule_if_needed(std::move(lock));
+    }
+
+private:
+    void terminate(std::unique_lock<std::mutex> lock, const std::exception_ptr& err) const
+    {
+        // same as observe_on: error is not delayed by queued items
+        disposable->is_terminated.store(true, std::memory_order::relaxed);
+        disposable->error = err;
+        disposable->queue.clear();
+        schedule_if_needed(std::move(lock));
+        disposable->has_space.notify_all();
+    }
+
+    void schedule_if_needed(std::unique_lock<std::mutex> lock) const
+    {
+        if (std::exchange(disposable->is_active, true))
+            return;
+
+        lock.unlock();
+        disposable->worker.schedule(
+            [](const wrapper_t& wrapper) -> rpp::schedulers::optional_delay_from_now {
+                drain_queue(*wrapper.disposable);
+                return std::nullopt;
+            },
+            wrapper_t{disposable});
+    }
+
+    static void drain_queue(disposable_t& disposable)
+    {
+        while (true)
+        {
+            std::unique_lock lock{disposable.mutex};
+            if (disposable.error)
+            {
+                lock.unlock();
+                disposable.observer.on_error(disposable.error);
+                return;
+            }
+
+            if (disposable.queue.empty())
+            {
+                if (disposable.is_completed)
+                {
+                    lock.unlock();
+                    disposable.observer.on_completed();
+                    return;
+                }
+
+                disposable.is_active = false;
+                return;
+            }
+
+            auto item = std::move(disposable.queue.front());
+            disposable.queue.pop_front();
+            lock.unlock();
+
+            if (disposable.policy == overflow_policy::block_producer)
+                disposable.has_space.notify_one();
+
+            disposable.observer.on_next(std::move(item));
+            disposable.demand.on_consumed();
+        }
+    }
+};
+
+template<rpp::schedulers::constraint::scheduler Scheduler>
+struct bounded_observe_on_t
+{
+    template<rpp::constraint::decayed_type T>
+    using result_value = T;
+
+    template<rpp::details::observables::constraint::disposable_strategy Prev>
+    using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+    RPP_NO_UNIQUE_ADDRESS Scheduler     scheduler;
+    size_t                              capacity;
+    overflow_policy                     policy;
+    std::shared_ptr<std::atomic_size_t> dropped = std::make_shared<std::atomic_size_t>();
+
+    /**
+     * @brief Total amount of items dropped because of overflow by all subscriptions made via this operator
+     */
+    size_t get_dropped_count() const { return dropped->load(std::memory_order::relaxed); }
+
+    template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
+    auto lift_with_disposable_strategy(Observer&& observer) const
+    {
+        return lift_impl<Type, DisposableStrategy, false>(std::forward<Observer>(observer));
+    }
+
+    template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
+    auto lift_with_requestable_upstream(Observer&& observer) const
+    {
+        return lift_impl<Type, DisposableStrategy, true>(std::forward<Observer>(observer));
+    }
+
+private:
+    template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, bool RequestableUpstream, rpp::constraint::observer Observer>
+    auto lift_impl(Observer&& observer) const
+    {
+        using worker_t  = rpp::schedulers::utils::get_worker_t<Scheduler>;
+        using container = typename DisposableStrategy::template add<worker_t::is_none_disposable ? 0 : 1>::disposable_container;
+
+        auto disposable = std::make_shared<bounded_observe_on_disposable<std::decay_t<Observer>, worker_t, container, RequestableUpstream>>(std::forward<Observer>(observer), scheduler.create_worker(), capacity, policy, dropped);
+        disposable->observer.set_upstream(rpp::disposable_wrapper::from_weak(disposable));
+        return rpp::observer<Type, bounded_observe_on_observer_strategy<std::decay_t<Observer>, worker_t, container, RequestableUpstream>>{std::move(disposable)};
+    }
+};
+} // namespace rpp::operators::details
 
 namespace rpp::operators
 {
@@ -42,4 +298,37 @@ auto observe_on(Scheduler&& scheduler, rpp::schedulers::duration delay_duration)
 {
     return details::delay_t<std::decay_t<Scheduler>, true>{delay_duration, std::forward<Scheduler>(scheduler)};
 }
+
+/**
+ * @brief Same as rpp::operators::observe_on, but keeps not more than `capacity` items scheduled but not emitted yet, so, slow observer can't cause unlimited memory growth.
+ * @details Items are kept in fixed-size ring buffer allocated once per subscription. When new item arrives while buffer is full, provided rpp::operators::overflow_policy is applied:
+ * - `drop_oldest` - the oldest queued item is dropped to free space for new one
+ * - `drop_newest` - new item is dropped
+ * - `block_producer` - thread emitting new item is blocked till observer consumes one of queued items
+ * - `error` - new item and all queued items are dropped and `on_error` with rpp::utils::queue_overflow is emitted
+ * @details Amount of dropped items (including ones dropped on `error` policy) can be obtained via `get_dropped_count()` of returned operator.
+ * @details In case of observable supports backpressure (see rpp::interface_requestable_disposable), operator requests not more than `capacity` items in advance, so, buffer is never overflowed.
+ *
+ * @par Performance notes:
+ * - 1 heap allocation for state and 1 heap allocation for buffer per subscription
+ * - no any allocations per emission
+ *
+ * @warning `block_producer` must not be used with scheduler executing schedulables in the same thread as producer (like rpp::schedulers::current_thread or rpp::schedulers::run_loop drained by producer's thread): it would cause deadlock.
+ *
+ * @param scheduler provides the threading model for emissions
+ * @param capacity maximum amount of queued items (at least 1)
+ * @param policy action applied to new item when queue is full
+ * @warning #include <rpp/operators/observe_on.hpp>
+ *
+ * @par Examples
+ * @snippet observe_on.cpp bounded_observe_on
+ *
+ * @ingroup utility_operators
+ * @see https://reactivex.io/documentation/operators/observeon.html
+ */
+template<rpp::schedulers::constraint::scheduler Scheduler>
+auto observe_on(Scheduler&& scheduler, size_t capacity, overflow_policy policy)
+{
+    return details::bounded_observe_on_t<std::decay_t<Scheduler>>{std::forward<Scheduler>(scheduler), capacity, policy};
+}
 } // namespace rpp::operators
@@ -19,8 +19,8 @@
 
 namespace rpp::operators::details
 {
-template<rpp::constraint::observer TObserver>
-class take_until_disposable : public rpp::composite_disposable
+template<rpp::constraint::observer TObserver, rpp::details::disposables::constraint::disposable_container Container>
+class take_until_disposable : public rpp::composite_disposable_impl<Container>
 {
 public:
     take_until_disposable(TObserver&& observer)
@@ -39,12 +39,12 @@ private:
     value_with_mutex<TObserver> m_observer_with_mutex{};
 };
 
-template<rpp::constraint::observer TObserver>
+template<rpp::constraint::observer TObserver, rpp::details::disposables::constraint::disposable_container Container>
 struct take_until_observer_strategy_base
 {
     using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-    RPP_NO_UNIQUE_ADDRESS std::shared_ptr<take_until_disposable<TObserver>> state;
+    RPP_NO_UNIQUE_ADDRESS std::shared_ptr<take_until_disposable<TObserver, Container>> state;
 
     void on_error(const std::exception_ptr& err) const 
     {
@@ -63,24 +63,24 @@ struct take_until_observer_strategy_base
     bool is_disposed() const { return state->is_disposed(); }
 };
 
-template<rpp::constraint::observer TObserver>
-struct take_until_throttle_observer_strategy : public take_until_observer_strategy_base<TObserver>
+template<rpp::constraint::observer TObserver, rpp::details::disposables::constraint::disposable_container Container>
+struct take_until_throttle_observer_strategy : public take_until_observer_strategy_base<TObserver, Container>
 {
     template<typename T>
     void on_next(const T&) const
     {
-        take_until_observer_strategy_base<TObserver>::state->dispose();
-        take_until_observer_strategy_base<TObserver>::state->get_observer()->on_completed();
+        take_until_observer_strategy_base<TObserver, Container>::state->dispose();
+        take_until_observer_strategy_base<TObserver, Container>::state->get_observer()->on_completed();
     }
 };
 
-template<rpp::constraint::observer TObserver>
-struct take_until_observer_strategy: public take_until_observer_strategy_base<TObserver>
+template<rpp::constraint::observer TObserver, rpp::details::disposables::constraint::disposable_container Container>
+struct take_until_observer_strategy: public take_until_observer_strategy_base<TObserver, Container>
 {
     template<typename T>
     void on_next(T&& v) const
     {
-        take_until_observer_strategy_base<TObserver>::state->get_observer()->on_next(std::forward<T>(v));
+        take_until_observer_strategy_base<TObserver, Container>::state->get_observer()->on_next(std::forward<T>(v));
     }
 };
 
@@ -98,15 +98,18 @@ struct take_until_t
     template<rpp::constraint::observer Observer, typename... Strategies>
     void subscribe(Observer&& observer, const observable_chain_strategy<Strategies...>& observable_strategy) const
     {
-        auto d = std::make_shared<take_until_disposable<std::decay_t<Observer>>>(std::forward<Observer>(observer));
+        // both observables put their disposables into the same disposable
+        using container = typename rpp::details::observables::combined_disposable_strategy_t<1, typename observable_chain_strategy<Strategies...>::expected_disposable_strategy, rpp::details::observables::deduce_disposable_strategy_t<TObservable>>::disposable_container;
+
+        auto d = std::make_shared<take_until_disposable<std::decay_t<Observer>, container>>(std::forward<Observer>(observer));
         d->get_observer()->set_upstream(rpp::disposable_wrapper::from_weak(d));
 
         // Need to take ownership over current_thread in case of inner-observables also uses them
         auto drain_on_exit = rpp::schedulers::current_thread::own_queue_and_drain_finally_if_not_owned();
-        observable.subscribe(take_until_throttle_observer_strategy<std::decay_t<Observer>>{d});
+        observable.subscribe(take_until_throttle_observer_strategy<std::decay_t<Observer>, container>{d});
 
         using expected_value = typename observable_chain_strategy<Strategies...>::value_type;
-        observable_strategy.subscribe(rpp::observer<expected_value, take_until_observer_strategy<std::decay_t<Observer>>>(std::move(d)));
+        observable_strategy.subscribe(rpp::observer<expected_value, take_until_observer_strategy<std::decay_t<Observer>, container>>(std::move(d)));
     }
 };
 }
@@ -19,36 +19,103 @@
 #include <rpp/schedulers/current_thread.hpp>
 
 #include <memory>
+#include <optional>
 #include <tuple>
+#include <utility>
 
 namespace rpp::operators::details
 {
-template<rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... RestArgs>
-class with_latest_from_disposable final : public composite_disposable
+template<rpp::constraint::observer Observer, rpp::details::disposables::constraint::disposable_container Container, typename TSelector, rpp::constraint::decayed_type OriginalValue, rpp::constraint::decayed_type... RestArgs>
+class with_latest_from_disposable final : public composite_disposable_impl<Container>
 {
+    struct completed
+    {
+    };
+
+    // latest values are updated and read serially with emissions, so, no any guarding is needed for them
+    struct handler
+    {
+        with_latest_from_disposable* self;
+
+        template<size_t I, typename T>
+            requires (I < sizeof...(RestArgs))
+        void operator()(std::in_place_index_t<I>, T&& v) const
+        {
+            self->m_values.template get<I>().emplace(std::forward<T>(v));
+        }
+
+        template<typename T>
+        void operator()(std::in_place_index_t<sizeof...(RestArgs)>, T&& v) const
+        {
+            if (self->m_is_terminated)
+                return;
+
+            self->m_values.apply([this, &v](const std::optional<RestArgs>&... vals) {
+                if ((vals.has_value() && ...))
+                    self->m_observer.on_next(self->m_selector(rpp::utils::as_const(std::forward<T>(v)), rpp::utils::as_const(vals.value())...));
+            });
+        }
+
+        void operator()(std::in_place_index_t<sizeof...(RestArgs) + 1>, const std::exception_ptr& err) const
+        {
+            if (!std::exchange(self->m_is_terminated, true))
+                self->m_observer.on_error(err);
+        }
+
+        void operator()(std::in_place_index_t<sizeof...(RestArgs) + 2>, completed) const
+        {
+            if (!std::exchange(self->m_is_terminated, true))
+                self->m_observer.on_completed();
+        }
+    };
+
 public:
     explicit with_latest_from_disposable(Observer&& observer, const TSelector& selector)
-        : observer_with_mutex{std::move(observer)}
-        , selector{selector}
+        : m_observer{std::move(observer)}
+        , m_selector{selector}
     {
     }
 
-    pointer_under_lock<Observer> get_observer_under_lock() { return pointer_under_lock{observer_with_mutex}; }
+    /**
+     * @brief Expected to be called before any emission (during subscription)
+     */
+    void set_upstream(const rpp::disposable_wrapper& d) { m_observer.set_upstream(d); }
 
-    rpp::utils::tuple<value_with_mutex<std::optional<RestArgs>>...>& get_values() { return values; }
+    template<size_t I, typename T>
+    void on_inner_next(T&& v)
+    {
+        m_drain.template emit<I>(handler{this}, std::forward<T>(v));
+    }
 
-    const TSelector& get_selector() const { return selector; }
+    template<typename T>
+    void on_next(T&& v)
+    {
+        m_drain.template emit<sizeof...(RestArgs)>(handler{this}, std::forward<T>(v));
+    }
+
+    void on_error(const std::exception_ptr& err)
+    {
+        m_drain.template emit<sizeof...(RestArgs) + 1>(handler{this}, err);
+    }
+
+    void on_completed()
+    {
+        m_drain.template emit<sizeof...(RestArgs) + 2>(handler{this}, completed{});
+    }
 
 private:
-    value_with_mutex<Observer>                                      observer_with_mutex{};
-    rpp::utils::tuple<value_with_mutex<std::optional<RestArgs>>...> values{};
-    RPP_NO_UNIQUE_ADDRESS TSelector                                 selector;
+    Observer                                      m_observer;
+    rpp::utils::tuple<std::optional<RestArgs>...> m_values{};
+    RPP_NO_UNIQUE_ADDRESS TSelector               m_selector;
+    bool                                          m_is_terminated{};
+
+    drain_loop<RestArgs..., OriginalValue, std::exception_ptr, completed> m_drain{};
 };
 
-template<size_t I, rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... RestArgs>
+template<size_t I, rpp::constraint::observer Observer, rpp::details::disposables::constraint::disposable_container Container, typename TSelector, rpp::constraint::decayed_type OriginalValue, rpp::constraint::decayed_type... RestArgs>
 struct with_latest_from_inner_observer_strategy
 {
-    std::shared_ptr<with_latest_from_disposable<Observer, TSelector, RestArgs...>> disposable{};
+    std::shared_ptr<with_latest_from_disposable<Observer, Container, TSelector, OriginalValue, RestArgs...>> disposable{};
 
     void set_upstream(const rpp::disposable_wrapper& d) const
     {
@@ -63,26 +130,23 @@ struct with_latest_from_inner_observer_strategy
     template<typename T>
     void on_next(T&& v) const
     {
-        auto& [value, mutex] = disposable->get_values().template get<I>();
-        std::scoped_lock lock{mutex};
-        value.emplace(std::forward<T>(v));
+        disposable->template on_inner_next<I>(std::forward<T>(v));
     }
 
     void on_error(const std::exception_ptr& err) const
     {
         disposable->dispose();
-        disposable->get_observer_under_lock()->on_error(err);
+        disposable->on_error(err);
     }
 
     static constexpr rpp::utils::empty_function_t<> on_completed{};
 };
 
-template<rpp::constraint::observer Observer, typename TSelector, typename OriginalValue, rpp::constraint::decayed_type... RestArgs>
+template<rpp::constraint::observer Observer, rpp::details::disposables::constraint::disposable_container Container, typename TSelector, rpp::constraint::decayed_type OriginalValue, rpp::constraint::decayed_type... RestArgs>
     requires std::invocable<TSelector, OriginalValue, RestArgs...>
 struct with_latest_from_observer_strategy
 {
-    using Disposable                      = with_latest_from_disposable<Observer, TSelector, RestArgs...>;
-    using Result                          = std::invoke_result_t<TSelector, OriginalValue, RestArgs...>;
+    using Disposable                    = with_latest_from_disposable<Observer, Container, TSelector, OriginalValue, RestArgs...>;
     using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
     std::shared_ptr<Disposable> disposable{};
@@ -100,28 +164,19 @@ struct with_latest_from_observer_strategy
     template<typename T>
     void on_next(T&& v) const
     {
-        auto result = disposable->get_values().apply([this, &v](value_with_mutex<std::optional<RestArgs>>&... vals) -> std::optional<Result> {
-            auto lock = std::scoped_lock{vals.mutex...};
-
-            if ((vals.value.has_value() && ...))
-                return disposable->get_selector()(rpp::utils::as_const(std::forward<T>(v)), rpp::utils::as_const(vals.value.value())...);
-            return std::nullopt;
-        });
-
-        if (result.has_value())
-            disposable->get_observer_under_lock()->on_next(std::move(result).value());
+        disposable->on_next(std::forward<T>(v));
     }
 
     void on_error(const std::exception_ptr& err) const
     {
         disposable->dispose();
-        disposable->get_observer_under_lock()->on_error(err);
+        disposable->on_error(err);
     }
 
     void on_completed() const
     {
         disposable->dispose();
-        disposable->get_observer_under_lock()->on_completed();
+        disposable->on_completed();
     }
 };
 
@@ -150,21 +205,22 @@ private:
     template<rpp::constraint::observer Observer, typename... Strategies>
     static void subscribe_impl(Observer&& observer, const observable_chain_strategy<Strategies...>& observable_strategy, const TSelector& selector, const TObservables&... observables)
     {
-        using Disposable = with_latest_from_disposable<Observer, TSelector, rpp::utils::extract_observable_type_t<TObservables>...>;
+        using ExpectedValue = typename observable_chain_strategy<Strategies...>::value_type;
+        // all observables put their disposables into the same disposable
+        using Container     = typename rpp::details::observables::combined_disposable_strategy_t<1, typename observable_chain_strategy<Strategies...>::expected_disposable_strategy, rpp::details::observables::deduce_disposable_strategy_t<TObservables>...>::disposable_container;
+        using Disposable    = with_latest_from_disposable<Observer, Container, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>;
 
         auto disposable = std::make_shared<Disposable>(std::forward<Observer>(observer), selector);
-        disposable->get_observer_under_lock()->set_upstream(rpp::disposable_wrapper::from_weak(disposable));
-        subscribe(disposable, std::index_sequence_for<TObservables...>{}, observables...);
-
-        using ExpectedValue = typename observable_chain_strategy<Strategies...>::value_type;
+        disposable->set_upstream(rpp::disposable_wrapper::from_weak(disposable));
+        subscribe<ExpectedValue>(disposable, std::index_sequence_for<TObservables...>{}, observables...);
 
-        observable_strategy.subscribe(rpp::observer<ExpectedValue, with_latest_from_observer_strategy<std::decay_t<Observer>, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{std::move(disposable)});
+        observable_strategy.subscribe(rpp::observer<ExpectedValue, with_latest_from_observer_strategy<std::decay_t<Observer>, Container, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{std::move(disposable)});
     }
 
-    template<rpp::constraint::observer Observer, size_t... I>
-    static void subscribe(std::shared_ptr<with_latest_from_disposable<Observer, TSelector, rpp::utils::extract_observable_type_t<TObservables>...>> disposable, std::index_sequence<I...>, const TObservables&... observables)
+    template<typename ExpectedValue, rpp::constraint::observer Observer, rpp::details::disposables::constraint::disposable_container Container, size_t... I>
+    static void subscribe(std::shared_ptr<with_latest_from_disposable<Observer, Container, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>> disposable, std::index_sequence<I...>, const TObservables&... observables)
     {
-        (..., observables.subscribe(rpp::observer<rpp::utils::extract_observable_type_t<TObservables>, with_latest_from_inner_observer_strategy<I, Observer, TSelector, rpp::utils::extract_observable_type_t<TObservables>...>>{disposable}));
+        (..., observables.subscribe(rpp::observer<rpp::utils::extract_observable_type_t<TObservables>, with_latest_from_inner_observer_strategy<I, Observer, Container, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{disposable}));
     }
 };
 }
@@ -186,7 +242,7 @@ namespace rpp::operators
  * @par Performance notes:
  * - 1 heap allocation for disposable
  * - each value from "others" copied/moved to internal storage
- * - mutex acquired every time value obtained
+ * - latest values are updated and read serially via lock-free queue-drain: no locks, concurrent emissions are queued (1 heap allocation per queued emission) and processed by thread which is emitting right now
  *
  * @param selector is applied to current emission of current observable and latests emissions from observables
  * @param observables are observables whose emissions would be combined when current observable sends new value
@@ -223,7 +279,7 @@ auto with_latest_from(TSelector&& selector, TObservable&& observable, TObservabl
  * @par Performance notes:
  * - 1 heap allocation for disposable
  * - each value from "others" copied/moved to internal storage
- * - mutex acquired every time value obtained
+ * - latest values are updated and read serially via lock-free queue-drain: no locks, concurrent emissions are queued (1 heap allocation per queued emission) and processed by thread which is emitting right now
  *
  * @param observables are observables whose emissions would be combined when current observable sends new value
  * @warning #include <rpp/operators/with_latest_from.hpp>
@@ -17,7 +17,11 @@
  * @ingroup rpp
  */
 
+#include <rpp/schedulers/clocks.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/event_loop.hpp>
 #include <rpp/schedulers/immediate.hpp>
 #include <rpp/schedulers/new_thread.hpp>
-#include <rpp/schedulers/run_loop.hpp>
\ No newline at end of file
+#include <rpp/schedulers/run_loop.hpp>
+#include <rpp/schedulers/thread_pool.hpp>
+#include <rpp/schedulers/virtual_time.hpp>
\ No newline at end of file
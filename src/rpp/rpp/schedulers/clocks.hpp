@@ -0,0 +1,204 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define RPP_HAS_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>
+    #define RPP_HAS_TSC 1
+#else
+    #define RPP_HAS_TSC 0
+#endif
+
+/**
+ * @defgroup clocks Clocks
+ * @brief Clock strategies used by queue-based schedulers (and so, by `now()` of their workers) to obtain current time_point.
+ * @details Clock used by schedulers can be selected via defining `RPP_SCHEDULERS_CLOCK` before including of any rpp header (or via compiler flags), for example `-DRPP_SCHEDULERS_CLOCK=rpp::schedulers::clocks::cached<rpp::schedulers::clocks::tsc>`. It must be the same for all translation units. Default one is `rpp::schedulers::clocks::steady`.
+ * @ingroup schedulers
+ */
+
+#if RPP_HAS_TSC
+namespace rpp::schedulers::details
+{
+struct tsc_anchor
+{
+    uint64_t   ticks{};
+    time_point time{};
+    double     ns_per_tick{};
+};
+
+/**
+ * @brief Converts TSC reading to time_point relative to anchor. Returns empty optional if reading is before anchor (thread migrated to core with TSC behind of anchored one) or `max_elapsed` or more after it: such a reading can't be trusted and clock has to be re-anchored.
+ */
+inline std::optional<time_point> tsc_to_time_point(const tsc_anchor& anchor, uint64_t ticks, duration max_elapsed)
+{
+    // unsigned difference wraps in case of TSC is behind, signed one is negative instead
+    const auto delta = static_cast<int64_t>(ticks - anchor.ticks);
+    if (delta < 0)
+        return std::nullopt;
+
+    const auto elapsed = std::chrono::duration<double, duration::period>{static_cast<double>(delta) * anchor.ns_per_tick};
+    if (elapsed >= max_elapsed)
+        return std::nullopt;
+    return anchor.time + std::chrono::duration_cast<duration>(elapsed);
+}
+} // namespace rpp::schedulers::details
+#endif
+
+namespace rpp::schedulers::clocks
+{
+/**
+ * @brief Just `std::chrono::steady_clock`
+ * @ingroup clocks
+ */
+struct steady
+{
+    static time_point now() { return clock_type::now(); }
+};
+
+/**
+ * @brief Clock based on time-stamp counter of CPU (`rdtsc`) converted to time_point of `std::chrono::steady_clock`. Reading of TSC is much cheaper than system call (or even vDSO call) of `steady_clock`.
+ *
+ * @details Rate of TSC is calibrated against `steady_clock`: during first `calibration_period` of process clock just forwards to `steady_clock`, after that each thread periodically re-anchors itself to `steady_clock` (once per `calibration_period` of its own TSC-based time) to avoid accumulation of drift. Clock is monotonic per thread.
+ * @details TSC reading before anchor of thread (migration to core with TSC behind) immediately re-anchors thread to `steady_clock` too, so, clock never jumps more than `calibration_period` ahead of `steady_clock`.
+ *
+ * Expects invariant TSC (any modern x86 CPU). On non-x86 platforms it is the same as `rpp::schedulers::clocks::steady`.
+ * @ingroup clocks
+ */
+struct tsc
+{
+    static constexpr duration calibration_period = std::chrono::milliseconds{10};
+
+    static time_point now()
+    {
+#if RPP_HAS_TSC
+        auto& anchor = s_anchor;
+        if (!anchor.ns_per_tick) [[unlikely]]
+            return calibrate(anchor, anchor.time);
+
+        if (const auto res = details::tsc_to_time_point(anchor, __rdtsc(), calibration_period)) [[likely]]
+            return *res;
+        // any value returned since last anchoring is less than this one
+        return calibrate(anchor, anchor.time + calibration_period);
+#else
+        return clock_type::now();
+#endif
+    }
+
+private:
+#if RPP_HAS_TSC
+    using anchor_t = details::tsc_anchor;
+
+    static const anchor_t& get_origin()
+    {
+        static const anchor_t origin{__rdtsc(), clock_type::now(), 0.0};
+        return origin;
+    }
+
+    static time_point calibrate(anchor_t& anchor, time_point lower_bound)
+    {
+        const auto& origin = get_origin();
+        const auto  ticks  = __rdtsc();
+        // never go backwards in case of TSC-based time was a bit ahead of real one
+        const auto time = std::max(clock_type::now(), lower_bound);
+
+        const auto elapsed = time - origin.time;
+        if (elapsed >= calibration_period && ticks > origin.ticks)
+        {
+            anchor.ns_per_tick = static_cast<double>(std::chrono::duration_cast<duration>(elapsed).count()) / static_cast<double>(ticks - origin.ticks);
+            anchor.ticks       = ticks;
+        }
+        anchor.time = time;
+        return time;
+    }
+
+    inline static thread_local anchor_t s_anchor{};
+#endif
+};
+
+/**
+ * @brief Coarse clock: reads underlying `Clock` once per batch of schedulables executed by scheduler and returns this cached value for any `now()` call in the current thread during this batch. Outside of batches it is the same as `Clock`.
+ *
+ * @details Time doesn't move during batch from the point of view of schedulables and operators (`interval`, `delay`, `throttle` and etc), so, it is useful when batches are short and clock reads are hot.
+ * @ingroup clocks
+ */
+template<typename Clock = steady>
+struct cached
+{
+    /**
+     * @brief RAII scope of batch: refreshes cached time on construction. Scopes can be nested.
+     */
+    class batch_scope
+    {
+    public:
+        batch_scope()
+            : m_previous{std::exchange(s_is_cached, true)}
+        {
+            s_cached = Clock::now();
+        }
+
+        batch_scope(const batch_scope&) = delete;
+        batch_scope(batch_scope&&)      = delete;
+
+        ~batch_scope() noexcept { s_is_cached = m_previous; }
+
+    private:
+        bool m_previous;
+    };
+
+    static time_point now() { return s_is_cached ? s_cached : Clock::now(); }
+
+private:
+    inline static thread_local bool       s_is_cached{};
+    inline static thread_local time_point s_cached{};
+};
+} // namespace rpp::schedulers::clocks
+
+#ifndef RPP_SCHEDULERS_CLOCK
+    #define RPP_SCHEDULERS_CLOCK rpp::schedulers::clocks::steady
+#endif
+
+namespace rpp::schedulers
+{
+/**
+ * @brief Clock used by all built-in schedulers (see `RPP_SCHEDULERS_CLOCK`)
+ * @ingroup clocks
+ */
+using default_clock = RPP_SCHEDULERS_CLOCK;
+} // namespace rpp::schedulers
+
+namespace rpp::schedulers::details
+{
+template<typename Clock>
+struct clock_batch_scope
+{
+};
+
+template<typename Clock>
+    requires requires { typename Clock::batch_scope; }
+struct clock_batch_scope<Clock> : Clock::batch_scope
+{
+};
+
+/**
+ * @brief Marks batch of executed schedulables for clocks caching time per batch (no-op for other clocks)
+ */
+using now_batch_scope = clock_batch_scope<default_clock>;
+} // namespace rpp::schedulers::details
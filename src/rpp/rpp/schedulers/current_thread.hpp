@@ -89,6 +89,7 @@ class current_thread
     friend class new_thread;
     class worker_strategy;
 
+    inline static thread_local details::schedulables_pool                                   s_pool{};
     inline static thread_local std::optional<details::schedulables_queue<worker_strategy>> s_queue{};
 
     struct is_queue_is_empty
@@ -117,12 +118,22 @@ class current_thread
             do
             {
                 if (timepoint && !top->is_disposed())
+                {
+                    // current_thread has no hook on disposal of schedulables, so purge them before going to sleep to not keep their captured state alive
+                    if (top->get_timepoint() > details::s_last_now_time && !queue->is_empty())
+                        queue->erase_disposed();
                     details::sleep_until(top->get_timepoint());
+                }
 
                 if (top->is_disposed())
+                {
                     timepoint.reset();
+                }
                 else
+                {
+                    [[maybe_unused]] const details::now_batch_scope now_scope{};
                     timepoint = (*top)();
+                }
 
             } while (queue->is_empty() && timepoint.has_value());
 
@@ -147,7 +158,7 @@ class current_thread
             std::optional<time_point> timepoint{};
             if (!someone_owns_queue)
             {
-                queue.emplace();
+                queue.emplace(s_pool);
 
                 timepoint = details::immediate_scheduling_while_condition<worker_strategy>(duration, is_queue_is_empty{queue.value()}, fn, handler, args...);
                 if (!timepoint || handler.is_disposed())
@@ -175,7 +186,7 @@ public:
         const bool someone_owns_queue = s_queue.has_value();
 
         if (!someone_owns_queue)
-            s_queue.emplace();
+            s_queue.emplace(s_pool);
 
         return rpp::utils::finally_action{!someone_owns_queue ? &drain_current_queue : &rpp::utils::empty_function<>};
     }
@@ -10,6 +10,8 @@
 #pragma once
 
 #include <rpp/schedulers/fwd.hpp>
+#include <rpp/schedulers/details/schedulables_pool.hpp>
+#include <rpp/schedulers/details/timing_wheel.hpp>
 #include <rpp/schedulers/details/utils.hpp>
 
 #include <rpp/defs.hpp>
@@ -17,13 +19,14 @@
 #include <rpp/utils/tuple.hpp>
 #include <rpp/utils/utils.hpp>
 
-#include <condition_variable>
+#include <algorithm>
+#include <atomic>
 #include <exception>
+#include <functional>
 #include <memory>
-#include <mutex>
 #include <optional>
-#include <queue>
 #include <utility>
+#include <vector>
 
 namespace rpp::schedulers::details
 {
@@ -44,20 +47,22 @@ public:
 
     void set_timepoint(const time_point& timepoint) { m_time_point = timepoint; }
 
-    const std::shared_ptr<schedulable_base>& get_next() const { return m_next; }
-
-    void set_next(std::shared_ptr<schedulable_base>&& next) { m_next = std::move(next); }
-
-    void update_next(std::shared_ptr<schedulable_base>&& next)
-    {
-        if (next)
-            next->set_next(std::move(m_next));
-        m_next = std::move(next);
-    }
+    static void* operator new(size_t size, schedulables_pool* pool) { return schedulables_pool::allocate(pool, size); }
+    static void  operator delete(void* ptr, schedulables_pool*) noexcept { schedulables_pool::deallocate(ptr); }
+    static void  operator delete(void* ptr) noexcept { schedulables_pool::deallocate(ptr); }
 
 private:
-    std::shared_ptr<schedulable_base> m_next{};
-    time_point                        m_time_point;
+    template<typename NowStrategy>
+    friend class schedulables_queue;
+    template<typename NowStrategy>
+    friend class schedulables_inbox;
+    template<typename Node>
+    friend class timing_wheel_storage;
+
+    schedulable_base*  m_next{};
+    schedulable_base** m_prev_next{};
+    time_point         m_time_point;
+    size_t             m_index{};
 };
 
 template<typename NowStrategy, rpp::constraint::decayed_type Fn, rpp::schedulers::constraint::schedulable_handler Handler, rpp::constraint::decayed_type... Args>
@@ -108,115 +113,340 @@ private:
     RPP_NO_UNIQUE_ADDRESS Fn                                  m_fn;
 };
 
-template<typename Mutex>
-class optional_mutex
+template<typename NowStrategy, rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+std::unique_ptr<schedulable_base> make_schedulable(schedulables_pool* pool, const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
 {
-public:
-    optional_mutex() {}
+    using schedulable_type = specific_schedulable<NowStrategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
+    static_assert(alignof(schedulable_type) <= alignof(std::max_align_t), "over-aligned schedulables are not supported");
+
+    return std::unique_ptr<schedulable_base>{new (pool) schedulable_type(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...)};
+}
+
+/**
+ * @brief Priority queue of schedulables ordered by time_point and then by order of insertion.
+ *
+ * @details Queue consists of two lanes:
+ * - FIFO lane keeps schedulables scheduled in non-decreasing order of time_point (most of zero-delay scheduling, `delay` with constant duration and etc). It is intrusive linked list, so, insertion and extraction are O(1) without any extra allocations.
+ * - binary heap keeps all other schedulables which arrived "out of order" (O(log n) insertion and extraction).
+ * - optional hierarchical timing wheel (see rpp::schedulers::timing_wheel) keeps "out of order" schedulables which are not due yet in terms of wheel's resolution with O(1) insertion. Content of the reached tick of the wheel is moved to binary heap only when it can become top of the queue.
+ *
+ * Top of the queue is minimal (time_point, insertion index) among heads of both lanes.
+ *
+ * Schedulables are allocated from provided schedulables_pool (if any), so, steady-state scheduling doesn't touch global allocator.
+ */
+template<typename NowStrategy>
+class schedulables_queue
+{
+    struct heap_entry
+    {
+        time_point        timepoint;
+        size_t            index;
+        schedulable_base* schedulable;
 
-    optional_mutex(Mutex* mutex)
-        : m_mutex{mutex}
+        bool operator>(const heap_entry& other) const
+        {
+            return timepoint > other.timepoint || (timepoint == other.timepoint && index > other.index);
+        }
+    };
+
+public:
+    schedulables_queue() = default;
+    schedulables_queue(const schedulables_queue&) = delete;
+    schedulables_queue(schedulables_queue&& other) noexcept
+        : m_fifo_head{std::exchange(other.m_fifo_head, nullptr)}
+        , m_fifo_tail{std::exchange(other.m_fifo_tail, nullptr)}
+        , m_fifo_size{std::exchange(other.m_fifo_size, 0)}
+        , m_heap{std::move(other.m_heap)}
+        , m_next_index{other.m_next_index}
+        , m_pool{other.m_pool}
+        , m_wheel{std::move(other.m_wheel)}
     {
+        other.m_heap.clear();
     }
 
-    void lock() const
+    schedulables_queue& operator=(const schedulables_queue& other) = delete;
+    schedulables_queue& operator=(schedulables_queue&& other) noexcept
     {
-        if (m_mutex)
-            m_mutex->lock();
+        schedulables_queue temp{std::move(other)};
+        std::swap(m_fifo_head, temp.m_fifo_head);
+        std::swap(m_fifo_tail, temp.m_fifo_tail);
+        std::swap(m_fifo_size, temp.m_fifo_size);
+        std::swap(m_heap, temp.m_heap);
+        std::swap(m_next_index, temp.m_next_index);
+        std::swap(m_pool, temp.m_pool);
+        std::swap(m_wheel, temp.m_wheel);
+        return *this;
     }
 
-    void unlock() const
+    explicit schedulables_queue(schedulables_pool& pool, const std::optional<timing_wheel>& wheel = {})
+        : m_pool{&pool}
+        , m_wheel{wheel ? std::make_unique<timing_wheel_storage<schedulable_base>>(wheel.value()) : nullptr}
     {
-        if (m_mutex)
-            m_mutex->unlock();
     }
 
-private:
-    Mutex* m_mutex{};
-};
-
-struct shared_queue_data
-{
-    std::condition_variable_any cv{};
-    std::recursive_mutex        mutex{};
-};
-
-template<typename NowStrategy>
-class schedulables_queue
-{
-public:
-    schedulables_queue() = default;
-    schedulables_queue(const schedulables_queue&) = delete;
-    schedulables_queue(schedulables_queue&&) noexcept = default;
-
-    schedulables_queue& operator=(const schedulables_queue& other) = delete;
-    schedulables_queue& operator=(schedulables_queue&& other) noexcept = default;
-
-    schedulables_queue(std::shared_ptr<shared_queue_data> shared_data)
-        : m_shared_data{std::move(shared_data)}
+    ~schedulables_queue() noexcept
     {
+        while (m_fifo_head)
+            delete std::exchange(m_fifo_head, m_fifo_head->m_next);
+
+        for (const auto& entry : m_heap)
+            delete entry.schedulable;
     }
 
     template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
     void emplace(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
     {
-        using schedulable_type = specific_schedulable<NowStrategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
-
-        emplace_impl(std::make_shared<schedulable_type>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
-        if (m_shared_data)
-            m_shared_data->cv.notify_all();
+        emplace_impl(make_schedulable<NowStrategy>(m_pool, timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
     }
 
-    void emplace(const time_point& timepoint, std::shared_ptr<schedulable_base>&& schedulable)
+    void emplace(const time_point& timepoint, std::unique_ptr<schedulable_base>&& schedulable)
     {
         if (!schedulable)
             return;
 
         schedulable->set_timepoint(timepoint);
         emplace_impl(std::move(schedulable));
-        if (m_shared_data)
-            m_shared_data->cv.notify_all();
     }
 
-    bool is_empty() const { return !m_head; }
+    bool is_empty() const { return !m_fifo_head && m_heap.empty() && (!m_wheel || m_wheel->is_empty()); }
+
+    size_t size() const { return m_fifo_size + m_heap.size() + (m_wheel ? m_wheel->size() : 0); }
 
-    std::shared_ptr<schedulable_base> pop()
+    std::unique_ptr<schedulable_base> pop()
     {
-        return std::exchange(m_head, m_head->get_next());
+        pour_wheel_if_needed();
+
+        if (is_top_in_fifo())
+        {
+            auto* res = std::exchange(m_fifo_head, m_fifo_head->m_next);
+            if (!m_fifo_head)
+                m_fifo_tail = nullptr;
+            --m_fifo_size;
+            res->m_next = nullptr;
+            return std::unique_ptr<schedulable_base>{res};
+        }
+
+        std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<>{});
+        auto* res = m_heap.back().schedulable;
+        m_heap.pop_back();
+        return std::unique_ptr<schedulable_base>{res};
     }
 
-    const std::shared_ptr<schedulable_base>& top() const
+    /**
+     * @brief Eagerly removes and destroys all disposed schedulables (instead of dropping them lazily when they reach top of queue), so, memory captured by them is released immediately.
+     */
+    void erase_disposed()
     {
-        return m_head;
+        const auto is_disposed = [](const schedulable_base* schedulable) { return schedulable->is_disposed(); };
+
+        schedulable_base** link = &m_fifo_head;
+        m_fifo_tail             = nullptr;
+        while (auto* schedulable = *link)
+        {
+            if (is_disposed(schedulable))
+            {
+                *link = schedulable->m_next;
+                --m_fifo_size;
+                delete schedulable;
+            }
+            else
+            {
+                m_fifo_tail = schedulable;
+                link        = &schedulable->m_next;
+            }
+        }
+
+        const auto heap_end = std::remove_if(m_heap.begin(), m_heap.end(), [&](const heap_entry& entry) {
+            if (!is_disposed(entry.schedulable))
+                return false;
+            delete entry.schedulable;
+            return true;
+        });
+        if (heap_end != m_heap.end())
+        {
+            m_heap.erase(heap_end, m_heap.end());
+            std::make_heap(m_heap.begin(), m_heap.end(), std::greater<>{});
+        }
+
+        if (m_wheel)
+            m_wheel->erase_if(is_disposed);
+    }
+
+    schedulable_base* top()
+    {
+        pour_wheel_if_needed();
+
+        return is_top_in_fifo() ? m_fifo_head : m_heap.front().schedulable;
     }
 
 private:
-    void emplace_impl(std::shared_ptr<schedulable_base>&& schedulable)
+    bool is_top_in_fifo() const
+    {
+        if (m_heap.empty())
+            return true;
+        if (!m_fifo_head)
+            return false;
+
+        const auto& heap_top = m_heap.front();
+        return m_fifo_head->m_time_point < heap_top.timepoint || (m_fifo_head->m_time_point == heap_top.timepoint && m_fifo_head->m_index < heap_top.index);
+    }
+
+    void pour_wheel_if_needed()
+    {
+        if (!m_wheel)
+            return;
+
+        while (!m_wheel->is_empty())
+        {
+            if (m_fifo_head || !m_heap.empty())
+            {
+                const auto local_top = is_top_in_fifo() ? m_fifo_head->m_time_point : m_heap.front().timepoint;
+                if (local_top < m_wheel->lower_bound())
+                    return;
+            }
+
+            m_wheel->advance([this](schedulable_base* schedulable) {
+                m_heap.push_back(heap_entry{schedulable->m_time_point, schedulable->m_index, schedulable});
+                std::push_heap(m_heap.begin(), m_heap.end(), std::greater<>{});
+            });
+        }
+    }
+
+    void emplace_impl(std::unique_ptr<schedulable_base>&& schedulable)
     {
-        // needed in case of new_thread and current_thread shares same queue
-        optional_mutex<std::recursive_mutex> mutex{m_shared_data ? &m_shared_data->mutex : nullptr};
-        std::lock_guard lock{mutex};
+        const auto timepoint = schedulable->get_timepoint();
+        const auto index     = m_next_index++;
+        schedulable->m_index = index;
 
-        if (!m_head || schedulable->get_timepoint() < m_head->get_timepoint())
+        // FIFO lane stays sorted as long as new schedulable is not earlier than its tail (insertion index is always increasing)
+        if (!m_fifo_tail || !(timepoint < m_fifo_tail->m_time_point))
         {
-            schedulable->set_next(std::move(m_head));
-            m_head = std::move(schedulable);
+            if (m_fifo_tail)
+                m_fifo_tail->m_next = schedulable.get();
+            else
+                m_fifo_head = schedulable.get();
+            m_fifo_tail = schedulable.release();
+            ++m_fifo_size;
             return;
         }
 
-        schedulable_base* current = m_head.get();
-        while (const auto& next = current->get_next())
+        if (m_wheel)
+        {
+            if (m_wheel->is_empty())
+                m_wheel->reset(NowStrategy::now());
+            if (m_wheel->insert(schedulable.get()))
+            {
+                schedulable.release();
+                return;
+            }
+        }
+
+        m_heap.push_back(heap_entry{timepoint, index, schedulable.get()});
+        schedulable.release();
+        std::push_heap(m_heap.begin(), m_heap.end(), std::greater<>{});
+    }
+
+private:
+    schedulable_base*       m_fifo_head{};
+    schedulable_base*       m_fifo_tail{};
+    size_t                  m_fifo_size{};
+    std::vector<heap_entry> m_heap{};
+    size_t                  m_next_index{};
+    schedulables_pool*      m_pool{};
+
+    std::unique_ptr<timing_wheel_storage<schedulable_base>> m_wheel{};
+};
+
+/**
+ * @brief Lock-free multi-producer inbox of schedulables.
+ *
+ * @details Any thread can submit schedulables without any locking: inbox is intrusive Treiber stack over the same link used by FIFO lane of schedulables_queue. Consumer takes all submitted schedulables at once and moves them into its own private queue in order of submission.
+ *
+ * Schedulables are allocated from provided schedulables_pool (if any).
+ */
+template<typename NowStrategy>
+class schedulables_inbox
+{
+public:
+    explicit schedulables_inbox(schedulables_pool* pool = nullptr)
+        : m_pool{pool}
+    {
+    }
+
+    schedulables_inbox(const schedulables_inbox&) = delete;
+    schedulables_inbox(schedulables_inbox&&)      = delete;
+
+    ~schedulables_inbox() noexcept
+    {
+        auto* head = m_head.exchange(nullptr, std::memory_order::acquire);
+        while (head)
+            delete std::exchange(head, head->m_next);
+    }
+
+    /**
+     * @returns true if inbox was empty before this submission
+     */
+    template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+    bool emplace(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
+    {
+        return push(make_schedulable<NowStrategy>(m_pool, timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+    }
+
+    /**
+     * @returns true if inbox was empty before this submission
+     */
+    bool emplace(const time_point& timepoint, std::unique_ptr<schedulable_base>&& schedulable)
+    {
+        if (!schedulable)
+            return false;
+
+        schedulable->set_timepoint(timepoint);
+        return push(std::move(schedulable));
+    }
+
+    bool is_empty() const { return !m_head.load(std::memory_order::seq_cst); }
+
+    /**
+     * @brief Moves all submitted schedulables into provided queue keeping order of submission.
+     */
+    void drain_to(schedulables_queue<NowStrategy>& queue)
+    {
+        auto* head = m_head.exchange(nullptr, std::memory_order::acquire);
+
+        // stack keeps schedulables in reversed order
+        schedulable_base* reversed{};
+        while (head)
+        {
+            auto* next = std::exchange(head->m_next, reversed);
+            reversed   = head;
+            head       = next;
+        }
+
+        while (reversed)
         {
-            if (schedulable->get_timepoint() < next->get_timepoint())
-                break;
-            current = next.get();
+            auto* next = std::exchange(reversed->m_next, nullptr);
+            queue.emplace(reversed->get_timepoint(), std::unique_ptr<schedulable_base>{reversed});
+            reversed = next;
         }
+    }
+
+private:
+    bool push(std::unique_ptr<schedulable_base>&& schedulable)
+    {
+        auto* node = schedulable.release();
+        auto* head = m_head.load(std::memory_order::relaxed);
+        do
+        {
+            node->m_next = head;
+            // seq_cst to pair with consumer which publishes its "parked" state before checking emptiness of inbox
+        } while (!m_head.compare_exchange_weak(head, node, std::memory_order::seq_cst, std::memory_order::relaxed));
 
-        current->update_next(std::move(schedulable));
+        // node can't be touched after publishing: consumer could already take it
+        return !head;
     }
 
 private:
-    std::shared_ptr<schedulable_base>  m_head{};
-    std::shared_ptr<shared_queue_data> m_shared_data{};
+    std::atomic<schedulable_base*> m_head{};
+    schedulables_pool*             m_pool{};
 };
-}
\ No newline at end of file
+}
@@ -0,0 +1,119 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2022 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <thread>
+
+namespace rpp::schedulers::details
+{
+/**
+ * @brief Pool of memory blocks for schedulables of one worker/queue.
+ *
+ * @details Blocks are grouped in size classes with granularity of `size_class_granularity` bytes. Each size class has its own intrusive free list, so, after warm-up, scheduling doesn't touch global allocator at all. Memory of free blocks is kept till destruction of pool.
+ *
+ * Thread-safety: both `allocate` and `deallocate` can be called from any thread at any time. Returning of block to free list is lock-free, while extraction of block is guarded with tiny spin-lock to avoid ABA problem between concurrent allocators.
+ *
+ * @warning Pool should outlive all blocks allocated from it
+ */
+class schedulables_pool
+{
+    struct alignas(std::max_align_t) header
+    {
+        schedulables_pool* pool;
+        size_t             size_class;
+    };
+
+    struct free_block
+    {
+        free_block* next;
+    };
+
+public:
+    static constexpr size_t size_class_granularity = 32;
+    static constexpr size_t size_classes_count     = 16;
+
+    schedulables_pool() = default;
+    schedulables_pool(const schedulables_pool&) = delete;
+    schedulables_pool(schedulables_pool&&) = delete;
+
+    ~schedulables_pool() noexcept
+    {
+        for (auto& head : m_free_lists)
+        {
+            auto* block = head.load(std::memory_order::acquire);
+            while (block)
+                ::operator delete(std::exchange(block, block->next));
+        }
+    }
+
+    /**
+     * @brief Allocates memory for object with provided size. Memory is aligned to `alignof(std::max_align_t)`.
+     * @param pool pool to allocate memory from. nullptr means global allocator.
+     */
+    static void* allocate(schedulables_pool* pool, size_t size)
+    {
+        const size_t total_size = sizeof(header) + size;
+        const size_t size_class = (total_size - 1) / size_class_granularity;
+        if (!pool || size_class >= size_classes_count)
+            return new (::operator new(total_size)) header{nullptr, size_class} + 1;
+
+        return new (pool->pop(size_class)) header{pool, size_class} + 1;
+    }
+
+    /**
+     * @brief Returns memory obtained via `allocate` back to pool it was allocated from.
+     */
+    static void deallocate(void* ptr) noexcept
+    {
+        auto* h = static_cast<header*>(ptr) - 1;
+        if (!h->pool)
+            return ::operator delete(h);
+
+        h->pool->push(h->size_class, h);
+    }
+
+private:
+    void* pop(size_t size_class)
+    {
+        // only one thread extracts blocks at a time, so, head can't be removed (and re-inserted back) in the middle of this operation
+        while (m_pop_lock.exchange(true, std::memory_order::acquire))
+            std::this_thread::yield();
+
+        auto& head  = m_free_lists[size_class];
+        auto* block = head.load(std::memory_order::acquire);
+        while (block && !head.compare_exchange_weak(block, block->next, std::memory_order::acquire, std::memory_order::acquire))
+        {
+        }
+
+        m_pop_lock.store(false, std::memory_order::release);
+
+        if (block)
+            return block;
+        return ::operator new((size_class + 1) * size_class_granularity);
+    }
+
+    void push(size_t size_class, void* ptr) noexcept
+    {
+        auto& head  = m_free_lists[size_class];
+        auto* block = new (ptr) free_block{head.load(std::memory_order::relaxed)};
+        while (!head.compare_exchange_weak(block->next, block, std::memory_order::release, std::memory_order::relaxed))
+        {
+        }
+    }
+
+private:
+    std::array<std::atomic<free_block*>, size_classes_count> m_free_lists{};
+    std::atomic_bool                                         m_pop_lock{};
+};
+} // namespace rpp::schedulers::details
@@ -0,0 +1,260 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <utility>
+
+namespace rpp::schedulers::details
+{
+/**
+ * @brief Hierarchical timing wheel of intrusive nodes (schedulables).
+ *
+ * @details Time is split into ticks of `timing_wheel::resolution`. Wheel consists of `levels_count` levels with `slots_per_level` slots each: slot of level `L` covers `slots_per_level^L` ticks. Node is placed into the lowest level where its tick differs from current tick of wheel, so, insertion and removal are O(1). Nodes of higher levels are cascaded to lower levels when wheel reaches their slot. Nodes too far from current tick are kept in separate overflow list.
+ *
+ * Wheel doesn't order nodes inside of one tick: it just hands all of them out at once, so, owner is responsible for exact ordering.
+ *
+ * Node is expected to provide `m_next` and `m_prev_next` links and `get_timepoint()` method.
+ */
+template<typename Node>
+class timing_wheel_storage
+{
+    static constexpr size_t   bits_per_level  = 6;
+    static constexpr size_t   slots_per_level = size_t{1} << bits_per_level;
+    static constexpr size_t   levels_count    = 4;
+    static constexpr uint64_t slot_mask       = slots_per_level - 1;
+
+public:
+    explicit timing_wheel_storage(const timing_wheel& config)
+        : m_resolution{std::max(config.resolution, duration{1})}
+    {
+    }
+
+    timing_wheel_storage(const timing_wheel_storage&) = delete;
+    timing_wheel_storage(timing_wheel_storage&&)      = delete;
+
+    ~timing_wheel_storage() noexcept
+    {
+        for (auto& level : m_slots)
+        {
+            for (auto* head : level)
+                delete_list(head);
+        }
+        delete_list(m_overflow);
+    }
+
+    bool is_empty() const { return m_size == 0; }
+
+    size_t size() const { return m_size; }
+
+    /**
+     * @brief Moves current tick of empty wheel to provided timepoint. Nodes not later than current tick are not accepted by wheel.
+     */
+    void reset(const time_point& now)
+    {
+        if (is_empty())
+            m_current_tick = to_tick(now);
+    }
+
+    /**
+     * @brief Inserts node into wheel in O(1)
+     * @returns false if node is already due in terms of wheel (its tick is not after current tick), so, node is not inserted
+     */
+    bool insert(Node* node)
+    {
+        const auto tick = to_tick(node->get_timepoint());
+        if (tick <= m_current_tick)
+            return false;
+
+        place(node, tick);
+        ++m_size;
+        return true;
+    }
+
+    /**
+     * @brief Removes node (previously inserted into wheel) in O(1)
+     */
+    void erase(Node* node)
+    {
+        unlink(node);
+        --m_size;
+    }
+
+    /**
+     * @brief Removes and destroys all nodes satisfying predicate
+     */
+    template<typename Pred>
+    void erase_if(const Pred& pred)
+    {
+        for (auto& level : m_slots)
+        {
+            for (auto* head : level)
+                erase_if(head, pred);
+        }
+        erase_if(m_overflow, pred);
+    }
+
+    /**
+     * @brief Lower bound of timepoints of all nodes inside of wheel
+     */
+    time_point lower_bound() const
+    {
+        for (size_t level = 0; level < levels_count; ++level)
+        {
+            if (const auto mask = m_occupied[level] & slots_after_current(level))
+                return to_timepoint(slot_begin(level, static_cast<uint64_t>(std::countr_zero(mask))));
+        }
+        // overflowed nodes differ from current tick at least at level above last one
+        const auto shift = bits_per_level * levels_count;
+        return to_timepoint(((m_current_tick >> shift) + 1) << shift);
+    }
+
+    /**
+     * @brief Advances wheel to the next non-empty slot. Nodes of the reached tick are passed to `out` (all of them have same tick), nodes of reached slot of higher level are cascaded to lower levels.
+     */
+    template<typename Out>
+    void advance(Out&& out)
+    {
+        for (size_t level = 0; level < levels_count; ++level)
+        {
+            auto mask = m_occupied[level] & slots_after_current(level);
+            while (mask)
+            {
+                const auto slot = static_cast<uint64_t>(std::countr_zero(mask));
+                mask &= mask - 1;
+                m_occupied[level] &= ~(uint64_t{1} << slot);
+
+                // slot can be empty due to erased nodes
+                auto* head = std::exchange(m_slots[level][slot], nullptr);
+                if (!head)
+                    continue;
+
+                m_current_tick = slot_begin(level, slot);
+                redistribute(head, out);
+                return;
+            }
+        }
+
+        if (!m_overflow)
+            return;
+
+        auto min_tick = to_tick(m_overflow->get_timepoint());
+        for (auto* node = m_overflow->m_next; node; node = node->m_next)
+            min_tick = std::min(min_tick, to_tick(node->get_timepoint()));
+
+        m_current_tick = min_tick;
+        redistribute(std::exchange(m_overflow, nullptr), out);
+    }
+
+private:
+    uint64_t to_tick(const time_point& timepoint) const
+    {
+        const auto ticks = timepoint.time_since_epoch() / m_resolution;
+        return ticks > 0 ? static_cast<uint64_t>(ticks) : 0;
+    }
+
+    time_point to_timepoint(uint64_t tick) const { return time_point{std::chrono::duration_cast<time_point::duration>(m_resolution * static_cast<duration::rep>(tick))}; }
+
+    uint64_t slots_after_current(size_t level) const
+    {
+        const auto current_slot = (m_current_tick >> (bits_per_level * level)) & slot_mask;
+        return ~((uint64_t{2} << current_slot) - 1);
+    }
+
+    uint64_t slot_begin(size_t level, uint64_t slot) const
+    {
+        const auto shift = bits_per_level * (level + 1);
+        return ((m_current_tick >> shift) << shift) | (slot << (bits_per_level * level));
+    }
+
+    template<typename Out>
+    void redistribute(Node* head, Out& out)
+    {
+        while (head)
+        {
+            auto*      node = std::exchange(head, head->m_next);
+            const auto tick = to_tick(node->get_timepoint());
+            if (tick == m_current_tick)
+            {
+                node->m_next      = nullptr;
+                node->m_prev_next = nullptr;
+                --m_size;
+                out(node);
+            }
+            else
+            {
+                place(node, tick);
+            }
+        }
+    }
+
+    void place(Node* node, uint64_t tick)
+    {
+        const auto level = (static_cast<size_t>(std::bit_width(tick ^ m_current_tick)) - 1) / bits_per_level;
+        if (level >= levels_count)
+            return push_front(m_overflow, node);
+
+        const auto slot = (tick >> (bits_per_level * level)) & slot_mask;
+        push_front(m_slots[level][slot], node);
+        m_occupied[level] |= uint64_t{1} << slot;
+    }
+
+    static void push_front(Node*& head, Node* node)
+    {
+        node->m_next      = head;
+        node->m_prev_next = &head;
+        if (head)
+            head->m_prev_next = &node->m_next;
+        head = node;
+    }
+
+    static void unlink(Node* node)
+    {
+        *node->m_prev_next = node->m_next;
+        if (node->m_next)
+            node->m_next->m_prev_next = node->m_prev_next;
+        node->m_next      = nullptr;
+        node->m_prev_next = nullptr;
+    }
+
+    template<typename Pred>
+    void erase_if(Node* head, const Pred& pred)
+    {
+        while (head)
+        {
+            auto* node = std::exchange(head, head->m_next);
+            if (pred(node))
+            {
+                erase(node);
+                delete node;
+            }
+        }
+    }
+
+    static void delete_list(Node* head)
+    {
+        while (head)
+            delete std::exchange(head, head->m_next);
+    }
+
+private:
+    std::array<std::array<Node*, slots_per_level>, levels_count> m_slots{};
+    std::array<uint64_t, levels_count>                           m_occupied{};
+    Node*                                                        m_overflow{};
+    duration                                                     m_resolution;
+    uint64_t                                                     m_current_tick{};
+    size_t                                                       m_size{};
+};
+} // namespace rpp::schedulers::details
@@ -11,6 +11,8 @@
 
 #include <rpp/schedulers/fwd.hpp>
 
+#include <rpp/schedulers/clocks.hpp>
+
 #include <exception>
 #include <optional>
 #include <thread>
@@ -19,7 +21,7 @@ namespace rpp::schedulers::details
 {
 inline thread_local time_point s_last_now_time{};
 
-inline rpp::schedulers::time_point now() { return s_last_now_time = clock_type::now(); }
+inline rpp::schedulers::time_point now() { return s_last_now_time = default_clock::now(); }
 
 inline bool sleep_until(const time_point timepoint)
 {
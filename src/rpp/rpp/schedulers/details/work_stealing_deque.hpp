@@ -0,0 +1,131 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace rpp::schedulers::details
+{
+/**
+ * @brief Chase-Lev work-stealing deque of pointers.
+ *
+ * @details Owner thread pushes and pops from the bottom (LIFO), any other thread can steal from the top (FIFO). Implementation follows "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê, Pop, Cohen, Zappa Nardelli). Buffer grows when it is full, previous buffers are kept till destruction of deque due to thieves can still read them.
+ *
+ * @warning `push` and `pop` can be called only by owner thread
+ */
+template<typename T>
+class work_stealing_deque
+{
+    class buffer
+    {
+    public:
+        explicit buffer(int64_t capacity)
+            : m_capacity{capacity}
+            , m_mask{capacity - 1}
+            , m_data{std::make_unique<std::atomic<T*>[]>(static_cast<size_t>(capacity))}
+        {
+        }
+
+        int64_t capacity() const { return m_capacity; }
+
+        T* get(int64_t index) const { return m_data[static_cast<size_t>(index & m_mask)].load(std::memory_order::relaxed); }
+
+        void put(int64_t index, T* value) { m_data[static_cast<size_t>(index & m_mask)].store(value, std::memory_order::relaxed); }
+
+        std::unique_ptr<buffer> grow(int64_t bottom, int64_t top) const
+        {
+            auto res = std::make_unique<buffer>(m_capacity * 2);
+            for (int64_t i = top; i != bottom; ++i)
+                res->put(i, get(i));
+            return res;
+        }
+
+    private:
+        int64_t                            m_capacity;
+        int64_t                            m_mask;
+        std::unique_ptr<std::atomic<T*>[]> m_data;
+    };
+
+public:
+    explicit work_stealing_deque(int64_t initial_capacity = 64)
+    {
+        m_buffers.push_back(std::make_unique<buffer>(initial_capacity));
+        m_buffer.store(m_buffers.back().get(), std::memory_order::relaxed);
+    }
+
+    work_stealing_deque(const work_stealing_deque&) = delete;
+    work_stealing_deque(work_stealing_deque&&)      = delete;
+
+    void push(T* value)
+    {
+        const auto b   = m_bottom.load(std::memory_order::relaxed);
+        const auto t   = m_top.load(std::memory_order::acquire);
+        auto*      buf = m_buffer.load(std::memory_order::relaxed);
+        if (b - t > buf->capacity() - 1)
+        {
+            m_buffers.push_back(buf->grow(b, t));
+            buf = m_buffers.back().get();
+            m_buffer.store(buf, std::memory_order::release);
+        }
+        buf->put(b, value);
+        m_bottom.store(b + 1, std::memory_order::release);
+    }
+
+    T* pop()
+    {
+        const auto b   = m_bottom.load(std::memory_order::relaxed) - 1;
+        auto*      buf = m_buffer.load(std::memory_order::relaxed);
+        m_bottom.store(b, std::memory_order::relaxed);
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        auto t = m_top.load(std::memory_order::relaxed);
+
+        if (t > b)
+        {
+            // deque was empty
+            m_bottom.store(b + 1, std::memory_order::relaxed);
+            return nullptr;
+        }
+
+        T* res = buf->get(b);
+        if (t == b)
+        {
+            // last element: race with thieves
+            if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order::seq_cst, std::memory_order::relaxed))
+                res = nullptr;
+            m_bottom.store(b + 1, std::memory_order::relaxed);
+        }
+        return res;
+    }
+
+    T* steal()
+    {
+        auto t = m_top.load(std::memory_order::acquire);
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        const auto b = m_bottom.load(std::memory_order::acquire);
+
+        if (t >= b)
+            return nullptr;
+
+        T* res = m_buffer.load(std::memory_order::acquire)->get(t);
+        if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order::seq_cst, std::memory_order::relaxed))
+            return nullptr;
+        return res;
+    }
+
+private:
+    alignas(64) std::atomic<int64_t>     m_top{};
+    alignas(64) std::atomic<int64_t>     m_bottom{};
+    std::atomic<buffer*>                 m_buffer{};
+    std::vector<std::unique_ptr<buffer>> m_buffers{};
+};
+} // namespace rpp::schedulers::details
@@ -0,0 +1,184 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/disposables/details/base_disposable.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/utils/constraints.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace rpp::schedulers
+{
+/**
+ * @brief Scheduler which owns fixed amount of long-lived threads and pins each worker to one of them.
+ *
+ * @details Threads are created once during construction of scheduler (instead of thread per "create_worker" call as in `new_thread`). Each "create_worker" call assigns worker to the least loaded thread (by amount of alive workers, round-robin among equally loaded threads).
+ * All schedulables of one worker are executed by one thread in order of time_point and insertion, so, it can be used anywhere where `new_thread` is used (for example, for `observe_on`).
+ *
+ * Disposing of worker's disposable cancels only schedulables of this worker, thread keeps working for other workers. Cancelled schedulables are removed from queue of the thread eagerly, so, memory captured by them (for example, by long `delay` or `debounce`) is released immediately instead of at their timepoints. Threads are alive while scheduler or any of its workers are alive.
+ *
+ * @ingroup schedulers
+ */
+class event_loop final
+{
+    using thread_t = new_thread::disposable;
+
+    struct loop_t
+    {
+        std::shared_ptr<thread_t> thread = std::make_shared<thread_t>();
+        std::atomic<size_t>       workers_count{};
+    };
+
+    class worker_disposable final : public rpp::details::base_disposable
+    {
+    public:
+        explicit worker_disposable(std::shared_ptr<loop_t> loop)
+            : m_loop{std::move(loop)}
+        {
+            m_loop->workers_count.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        ~worker_disposable() override { m_loop->workers_count.fetch_sub(1, std::memory_order::relaxed); }
+
+        thread_t& get_thread() const { return *m_loop->thread; }
+
+    private:
+        void dispose_impl() noexcept override
+        {
+            // schedulables of this worker are useless now: release memory captured by them right now instead of waiting for their timepoints
+            get_thread().erase_disposed_schedulables();
+        }
+
+    private:
+        std::shared_ptr<loop_t> m_loop;
+    };
+
+    template<rpp::schedulers::constraint::schedulable_handler Handler>
+    class worker_handler
+    {
+    public:
+        template<rpp::constraint::decayed_same_as<Handler> THandler>
+        worker_handler(THandler&& handler, std::shared_ptr<worker_disposable> disposable)
+            : m_handler{std::forward<THandler>(handler)}
+            , m_disposable{std::move(disposable)}
+        {
+        }
+
+        bool is_disposed() const { return m_disposable->is_disposed() || m_handler.is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { m_handler.on_error(err); }
+
+        Handler& get_handler() { return m_handler; }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS Handler      m_handler;
+        std::shared_ptr<worker_disposable> m_disposable;
+    };
+
+    template<typename Fn>
+    struct worker_fn
+    {
+        RPP_NO_UNIQUE_ADDRESS Fn fn;
+
+        template<typename Handler, typename... Args>
+        auto operator()(worker_handler<Handler>& handler, Args&... args) -> std::invoke_result_t<Fn&, Handler&, Args&...>
+        {
+            return fn(handler.get_handler(), args...);
+        }
+    };
+
+    class worker_strategy
+    {
+    public:
+        explicit worker_strategy(std::shared_ptr<loop_t> loop)
+            : m_disposable{std::make_shared<worker_disposable>(std::move(loop))}
+        {
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void defer_for(duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            if (m_disposable->is_disposed())
+                return;
+
+            m_disposable->get_thread().defer_at(now() + duration,
+                                                worker_fn<std::decay_t<Fn>>{std::forward<Fn>(fn)},
+                                                worker_handler<std::decay_t<Handler>>{std::forward<Handler>(handler), m_disposable},
+                                                std::forward<Args>(args)...);
+        }
+
+        rpp::disposable_wrapper get_disposable() const { return rpp::disposable_wrapper{m_disposable}; }
+
+        static rpp::schedulers::time_point now() { return details::now(); }
+
+    private:
+        std::shared_ptr<worker_disposable> m_disposable;
+    };
+
+public:
+    /**
+     * @param threads_count amount of threads owned by scheduler. Zero means `std::thread::hardware_concurrency()`
+     */
+    explicit event_loop(size_t threads_count = 0)
+        : m_state{std::make_shared<state_t>(threads_count ? threads_count : std::max(1u, std::thread::hardware_concurrency()))}
+    {
+    }
+
+    rpp::schedulers::worker<worker_strategy> create_worker() const
+    {
+        return rpp::schedulers::worker<worker_strategy>{m_state->get_least_loaded()};
+    }
+
+private:
+    class state_t
+    {
+    public:
+        explicit state_t(size_t threads_count)
+        {
+            m_loops.reserve(threads_count);
+            for (size_t i = 0; i < threads_count; ++i)
+                m_loops.push_back(std::make_shared<loop_t>());
+        }
+
+        std::shared_ptr<loop_t> get_least_loaded()
+        {
+            // round-robin start to spread workers among equally loaded threads
+            const size_t start = m_next.fetch_add(1, std::memory_order::relaxed);
+            size_t       best  = start % m_loops.size();
+            for (size_t i = 1; i < m_loops.size(); ++i)
+            {
+                const size_t index = (start + i) % m_loops.size();
+                if (m_loops[index]->workers_count.load(std::memory_order::relaxed) < m_loops[best]->workers_count.load(std::memory_order::relaxed))
+                    best = index;
+            }
+            return m_loops[best];
+        }
+
+    private:
+        std::vector<std::shared_ptr<loop_t>> m_loops{};
+        std::atomic<size_t>                  m_next{};
+    };
+
+    std::shared_ptr<state_t> m_state;
+};
+} // namespace rpp::schedulers
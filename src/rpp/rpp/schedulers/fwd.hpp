@@ -73,6 +73,22 @@ struct delay_to
     time_point value;
 };
 
+/**
+ * @brief Selects hierarchical timing wheel as storage of delayed schedulables of queue-based scheduler.
+ *
+ * @details By default queue-based schedulers keep delayed schedulables (which arrive out of order) in binary heap with O(log n) insertion. Timing wheel provides O(1) insertion and removal at the cost of some fixed memory per worker, so, it is useful for workers with huge amount of concurrently armed timers (`debounce`, `delay`, `timeout` and etc).
+ *
+ * Timepoints are rounded to `resolution` only for bucketing: schedulables are still executed in exact order of timepoints and insertion.
+ */
+struct timing_wheel
+{
+    explicit timing_wheel(duration resolution = std::chrono::milliseconds{1})
+    : resolution{resolution}
+    {}
+
+    duration resolution;
+};
+
 using optional_delay_from_now = std::optional<delay_from_now>;
 using optional_delay_from_this_timepoint = std::optional<delay_from_this_timepoint>;
 using optional_delay_to = std::optional<delay_to>;
@@ -135,6 +151,9 @@ class immediate;
 class current_thread;
 class new_thread;
 class run_loop;
+class thread_pool;
+class event_loop;
+class virtual_time;
 
 namespace defaults
 {
@@ -75,7 +75,7 @@ public:
 
         static constexpr rpp::schedulers::details::none_disposable get_disposable() { return {}; }
 
-        static rpp::schedulers::time_point now() { return rpp::schedulers::clock_type::now(); }
+        static rpp::schedulers::time_point now() { return default_clock::now(); }
     };
 
     static rpp::schedulers::worker<worker_strategy> create_worker()
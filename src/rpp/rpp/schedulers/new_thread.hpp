@@ -17,7 +17,9 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
+#include <vector>
 
 namespace rpp::schedulers
 {
@@ -29,15 +31,14 @@ namespace rpp::schedulers
  */
 class new_thread
 {
+    friend class event_loop;
+
     class disposable final : public rpp::details::base_disposable
     {
     public:
-        disposable()
+        explicit disposable(const std::optional<timing_wheel>& wheel = {})
+            : m_state{std::make_shared<state_t>(wheel)}
         {
-            // just waiting
-            while (!m_state->queue_ptr.load(std::memory_order::relaxed))
-            {
-            };
         }
 
         ~disposable() override
@@ -47,7 +48,7 @@ class new_thread
 
             // just notify
             m_state->is_destroying.store(true, std::memory_order::relaxed);
-            m_state->cv.notify_all();
+            m_state->notify();
             m_thread.detach();
         }
 
@@ -57,10 +58,21 @@ class new_thread
             if (is_disposed())
                 return;
 
-            std::lock_guard lock{m_state->mutex};
-            // guarded by lock
-            if (const auto queue = m_state->queue_ptr.load(std::memory_order::relaxed))
-                queue->emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            // only submission into empty inbox can find consumer parked: it is going to drain all of them at once after wake up
+            const bool was_empty = m_state->inbox.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            // seq_cst to pair with inbox's submission: either consumer sees new schedulable or we see that consumer is parked
+            if (was_empty && m_state->is_parked.load(std::memory_order::seq_cst))
+                m_state->notify();
+        }
+
+        /**
+         * @brief Requests thread to eagerly remove disposed schedulables from its queue instead of dropping them when they reach top of queue.
+         */
+        void erase_disposed_schedulables()
+        {
+            m_state->erase_disposed_requested.store(true, std::memory_order::seq_cst);
+            if (m_state->is_parked.load(std::memory_order::seq_cst))
+                m_state->notify();
         }
 
     private:
@@ -71,7 +83,7 @@ class new_thread
 
             // just need atomicity, not guarding anything
             m_state->is_disposed.store(true, std::memory_order::relaxed);
-            m_state->cv.notify_all();
+            m_state->notify();
 
             if (m_thread.get_id() != std::this_thread::get_id())
                 m_thread.join();
@@ -79,59 +91,101 @@ class new_thread
                 m_thread.detach();
         }
 
-        struct state_t : public details::shared_queue_data
+        struct state_t
         {
-            std::atomic<details::schedulables_queue<current_thread::worker_strategy>*> queue_ptr{};
-            std::atomic_bool                                                           is_disposed{};
-            std::atomic_bool                                                           is_destroying{};
+            explicit state_t(const std::optional<timing_wheel>& wheel)
+                : wheel{wheel}
+            {
+            }
+
+            bool is_stopped() const { return is_disposed.load(std::memory_order::relaxed) || is_destroying.load(std::memory_order::relaxed); }
+
+            void notify()
+            {
+                // lock is needed to not miss notification between check of predicate and waiting by consumer
+                {
+                    std::lock_guard lock{mutex};
+                }
+                cv.notify_one();
+            }
+
+            void park(const std::optional<time_point>& timepoint)
+            {
+                std::unique_lock lock{mutex};
+                is_parked.store(true, std::memory_order::seq_cst);
+
+                const auto pred = [&] { return is_stopped() || !inbox.is_empty() || erase_disposed_requested.load(std::memory_order::seq_cst); };
+                if (timepoint)
+                    cv.wait_until(lock, timepoint.value(), pred);
+                else
+                    cv.wait(lock, pred);
+
+                is_parked.store(false, std::memory_order::relaxed);
+            }
+
+            std::optional<timing_wheel>                                  wheel;
+            std::mutex                                                   mutex{};
+            std::condition_variable                                      cv{};
+            details::schedulables_pool                                   pool{};
+            details::schedulables_inbox<current_thread::worker_strategy> inbox{&pool};
+            std::atomic_bool                                             is_parked{};
+            std::atomic_bool                                             erase_disposed_requested{};
+            std::atomic_bool                                             is_disposed{};
+            std::atomic_bool                                             is_destroying{};
         };
 
         static void data_thread(std::shared_ptr<state_t> state)
         {
-            auto&            queue = current_thread::s_queue;
-            state->queue_ptr.store(&queue.emplace(state), std::memory_order::relaxed);
+            // queue is private for this thread: other threads submit schedulables via lock-free inbox
+            auto& queue = current_thread::s_queue;
+            queue.emplace(state->pool, state->wheel);
 
-            while (!state->is_disposed.load(std::memory_order::relaxed))
+            std::vector<std::unique_ptr<details::schedulable_base>> batch{};
+            while (!state->is_stopped())
             {
-                std::unique_lock lock{state->mutex};
-                
-                if (state->is_destroying.load(std::memory_order::relaxed) && queue->is_empty())
-                    break;
+                state->inbox.drain_to(queue.value());
 
-                state->cv.wait(lock, [&] { return state->is_disposed.load(std::memory_order::relaxed) || !queue->is_empty() || state->is_destroying.load(std::memory_order::relaxed); });
+                if (state->erase_disposed_requested.exchange(false, std::memory_order::acq_rel))
+                    queue->erase_disposed();
 
-                if (state->is_disposed.load(std::memory_order::relaxed) || state->is_destroying.load(std::memory_order::relaxed))
-                    break;
-
-                if (queue->top()->is_disposed())
+                if (queue->is_empty())
                 {
-                    queue->pop();
+                    state->park(std::nullopt);
                     continue;
                 }
 
-                if (details::s_last_now_time < queue->top()->get_timepoint())
+                // take every schedulable which is already due at once to amortize clock reads and draining of inbox
+                [[maybe_unused]] const details::now_batch_scope now_scope{};
+                const auto                                      now = worker_strategy::now();
+                while (!queue->is_empty() && (queue->top()->is_disposed() || queue->top()->get_timepoint() <= now))
+                    batch.push_back(queue->pop());
+
+                if (batch.empty())
                 {
-                    if (const auto now = worker_strategy::now(); now < queue->top()->get_timepoint())
-                    {
-                        state->cv.wait_for(lock, queue->top()->get_timepoint() - now, [&] { return state->is_disposed.load(std::memory_order::relaxed) || state->is_destroying.load(std::memory_order::relaxed) || worker_strategy::now() >= queue->top()->get_timepoint(); });
-                        continue;
-                    }
+                    state->park(queue->top()->get_timepoint());
+                    continue;
                 }
 
-                auto top = queue->pop();
-                lock.unlock();
+                for (auto& top : batch)
+                {
+                    // worker could be disposed by one of schedulables of batch
+                    if (state->is_stopped())
+                        break;
+
+                    if (top->is_disposed())
+                        continue;
 
-                if (const auto timepoint = (*top)())
-                    queue->emplace(timepoint.value(), std::move(top));
+                    if (const auto timepoint = (*top)())
+                        queue->emplace(timepoint.value(), std::move(top));
+                }
+                batch.clear();
             }
 
-            std::unique_lock lock{state->mutex};
-            state->queue_ptr.store(nullptr, std::memory_order::relaxed);
             queue.reset();
         }
 
     private:
-        std::shared_ptr<state_t> m_state = std::make_shared<state_t>();
+        std::shared_ptr<state_t> m_state;
         std::thread              m_thread{&data_thread, m_state};
     };
 
@@ -141,6 +195,11 @@ public:
     public:
         worker_strategy() = default;
 
+        explicit worker_strategy(const timing_wheel& wheel)
+            : m_state{std::make_shared<disposable>(wheel)}
+        {
+        }
+
         template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
         void defer_for(duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
         {
@@ -159,5 +218,13 @@ public:
     {
         return rpp::schedulers::worker<worker_strategy>{};
     }
+
+    /**
+     * @brief Creates worker which keeps delayed schedulables in hierarchical timing wheel instead of binary heap
+     */
+    static rpp::schedulers::worker<worker_strategy> create_worker(const timing_wheel& wheel)
+    {
+        return rpp::schedulers::worker<worker_strategy>{wheel};
+    }
 };
 }
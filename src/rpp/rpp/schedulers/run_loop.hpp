@@ -19,6 +19,11 @@
 #include <rpp/schedulers/details/queue.hpp>
 #include <rpp/utils/functors.hpp>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+
 namespace rpp::schedulers
 {
 /**
@@ -34,37 +39,45 @@ class run_loop final
     class state_t final : public rpp::details::base_disposable
     {
     public:
+        explicit state_t(const std::optional<timing_wheel>& wheel = {})
+            : m_wheel{wheel}
+        {
+        }
+
         template<typename ...Args>
         void emplace_and_notify(time_point timepoint, Args&& ...args)
         {
             if (is_disposed())
                 return;
 
+            // only submission into empty inbox can find consumer parked: it is going to drain all of them at once after wake up
+            const bool was_empty = m_inbox.emplace(timepoint, std::forward<Args>(args)...);
+            // seq_cst to pair with inbox's submission: either consumer sees new schedulable or we see that consumer is parked
+            if (was_empty && m_parked_count.load(std::memory_order::seq_cst))
             {
-                std::lock_guard lock{m_mutex};
-                m_queue.emplace(timepoint, std::forward<Args>(args)...);
+                // lock is needed to not miss notification between check of predicate and waiting by consumer
+                {
+                    std::lock_guard lock{m_mutex};
+                }
+                m_cv.notify_one();
             }
-            m_cv.notify_one();
         }
 
-        std::shared_ptr<details::schedulable_base> pop(bool wait)
+        std::unique_ptr<details::schedulable_base> pop(bool wait)
         {
-            while(!is_disposed())
+            std::unique_lock lock{m_mutex};
+            while (!is_disposed())
             {
-                std::unique_lock lock{m_mutex};
-                m_cv.wait(lock, [&] { return !wait || is_disposed() || !m_queue.is_empty(); });
+                m_inbox.drain_to(m_queue);
 
-                if (is_disposed())
-                    break;
-            
                 const auto now = worker_strategy::now();
                 if (is_any_ready_schedulable_unsafe(now))
                     return m_queue.pop();
-                
+
                 if (!wait)
                     break;
-                
-                m_cv.wait_for(lock, m_queue.top()->get_timepoint() - now, [&](){ return is_disposed() || !m_queue.is_empty() || m_queue.top()->get_timepoint() <= worker_strategy::now(); });
+
+                park(lock, m_queue.is_empty() ? std::nullopt : std::optional{m_queue.top()->get_timepoint()});
             }
             return {};
         }
@@ -72,35 +85,55 @@ class run_loop final
         bool is_any_ready_schedulable() 
         {
             std::lock_guard lock{m_mutex};
+            m_inbox.drain_to(m_queue);
             return is_any_ready_schedulable_unsafe();
         }
 
         bool is_empty() 
         {
             std::lock_guard lock{m_mutex};
+            m_inbox.drain_to(m_queue);
             return m_queue.is_empty();
         }
 
     private:
-        bool is_any_ready_schedulable_unsafe(time_point now = worker_strategy::now()) const
+        bool is_any_ready_schedulable_unsafe(time_point now = worker_strategy::now())
         {
             return !m_queue.is_empty() && (m_queue.top()->is_disposed() || m_queue.top()->get_timepoint() <= now);
         }
 
+        void park(std::unique_lock<std::mutex>& lock, const std::optional<time_point>& timepoint)
+        {
+            m_parked_count.fetch_add(1, std::memory_order::seq_cst);
+
+            const auto pred = [&] { return is_disposed() || !m_inbox.is_empty(); };
+            if (timepoint)
+                m_cv.wait_until(lock, timepoint.value(), pred);
+            else
+                m_cv.wait(lock, pred);
+
+            m_parked_count.fetch_sub(1, std::memory_order::relaxed);
+        }
+
         void dispose_impl() noexcept override 
         {
             {
                 std::lock_guard lock{m_mutex};
-                m_queue = details::schedulables_queue<worker_strategy>{};
+                auto queue = std::exchange(m_queue, details::schedulables_queue<worker_strategy>{m_pool, m_wheel});
+                m_inbox.drain_to(queue);
             }
-            m_cv.notify_one();
+            m_cv.notify_all();
         }
 
     private:
-        std::mutex                  m_mutex{};
-        details::schedulables_queue<worker_strategy> m_queue{};
-
-        std::condition_variable     m_cv{};
+        std::mutex                                   m_mutex{};
+        std::optional<timing_wheel>                  m_wheel{};
+        details::schedulables_pool                   m_pool{};
+        details::schedulables_queue<worker_strategy> m_queue{m_pool, m_wheel};
+        details::schedulables_inbox<worker_strategy> m_inbox{&m_pool};
+        std::atomic_size_t                           m_parked_count{};
+
+        std::condition_variable                      m_cv{};
     };
 
     class worker_strategy
@@ -125,6 +158,16 @@ class run_loop final
     };
 
 public:
+    run_loop() = default;
+
+    /**
+     * @brief Keeps delayed schedulables in hierarchical timing wheel instead of binary heap
+     */
+    explicit run_loop(const timing_wheel& wheel)
+        : m_state{std::make_shared<state_t>(wheel)}
+    {
+    }
+
     bool is_empty() const
     {
         return m_state->is_empty();
@@ -157,6 +200,7 @@ private:
             if (top->is_disposed())
                 return;
 
+            [[maybe_unused]] const details::now_batch_scope now_scope{};
             if (const auto timepoint = (*top)())
                 m_state->emplace_and_notify(timepoint.value(), std::move(top));
         }
@@ -0,0 +1,454 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/disposables/details/base_disposable.hpp>
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/schedulables_pool.hpp>
+#include <rpp/schedulers/details/work_stealing_deque.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rpp::schedulers
+{
+/**
+ * @brief Scheduler which schedules invoking of schedulables to fixed amount of threads via work-stealing.
+ *
+ * @details Each "create_worker" call creates lightweight worker (strand) with its own queue of schedulables ordered by time_point and order of insertion. Worker never executes its schedulables in parallel and keeps their order, so, it can be used for `observe_on` the same way as `new_thread`.
+ * Workers with ready schedulables are distributed among threads of pool via per-thread Chase-Lev deques: thread pushes/pops workers to/from its own deque and steals from deques of other threads when own deque is empty.
+ *
+ * Threads of pool are alive while scheduler or any of its workers with pending schedulables are alive.
+ *
+ * @ingroup schedulers
+ */
+class thread_pool final
+{
+    class strand;
+
+    class state_t
+    {
+        struct timer_entry
+        {
+            time_point            timepoint;
+            size_t                generation;
+            std::weak_ptr<strand> target;
+
+            bool operator>(const timer_entry& other) const { return timepoint > other.timepoint; }
+        };
+
+    public:
+        explicit state_t(size_t threads_count)
+            : m_deques(threads_count)
+        {
+        }
+
+        void submit(strand* target)
+        {
+            if (s_current_state == this)
+            {
+                m_deques[s_current_index].push(target);
+                if (m_sleeping_count.load(std::memory_order::relaxed) != 0)
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_cv.notify_one();
+                }
+                return;
+            }
+
+            submit_shared(target);
+        }
+
+        void submit_shared(strand* target)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                m_shared.push_back(target);
+            }
+            m_cv.notify_one();
+        }
+
+        void submit_at(time_point timepoint, std::weak_ptr<strand> target, size_t generation)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                m_timers.push_back(timer_entry{timepoint, generation, std::move(target)});
+                std::push_heap(m_timers.begin(), m_timers.end(), std::greater<>{});
+                if (m_timers.front().generation != generation || m_timers.front().timepoint != timepoint)
+                    return;
+            }
+            // new timer is earliest one, so, sleeping thread should re-calculate its deadline
+            m_cv.notify_one();
+        }
+
+        void stop()
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                m_stopped = true;
+            }
+            m_cv.notify_all();
+        }
+
+        void run(size_t index)
+        {
+            s_current_state = this;
+            s_current_index = index;
+
+            for (size_t tick = 1;; ++tick)
+            {
+                // check shared queue from time to time to avoid starvation of shared schedulables and timers
+                strand* target = tick % 32 == 0 ? try_get_shared() : nullptr;
+                if (!target)
+                    target = m_deques[index].pop();
+                if (!target)
+                    target = try_get_shared();
+                if (!target)
+                    target = try_steal(index);
+
+                if (!target)
+                {
+                    if (!wait_for_work())
+                        break;
+                    continue;
+                }
+
+                if (target->run())
+                    submit_shared(target);
+            }
+
+            s_current_state = nullptr;
+        }
+
+    private:
+        strand* try_get_shared()
+        {
+            std::vector<timer_entry> expired_timers{};
+            strand*                  res{};
+            {
+                std::lock_guard lock{m_mutex};
+                if (!m_timers.empty())
+                {
+                    const auto now = details::now();
+                    while (!m_timers.empty() && m_timers.front().timepoint <= now)
+                    {
+                        std::pop_heap(m_timers.begin(), m_timers.end(), std::greater<>{});
+                        expired_timers.push_back(std::move(m_timers.back()));
+                        m_timers.pop_back();
+                    }
+                }
+
+                if (!m_shared.empty())
+                {
+                    res = m_shared.front();
+                    m_shared.pop_front();
+                }
+            }
+
+            for (const auto& timer : expired_timers)
+            {
+                const auto target = timer.target.lock();
+                if (!target || !target->wake_by_timer(timer.generation))
+                    continue;
+
+                if (!res)
+                    res = target.get();
+                else
+                    submit(target.get());
+            }
+            return res;
+        }
+
+        strand* try_steal(size_t index)
+        {
+            for (size_t i = 1; i < m_deques.size(); ++i)
+            {
+                if (auto* res = m_deques[(index + i) % m_deques.size()].steal())
+                    return res;
+            }
+            return nullptr;
+        }
+
+        bool wait_for_work()
+        {
+            std::unique_lock lock{m_mutex};
+            if (m_stopped)
+                return false;
+
+            if (!m_shared.empty() || (!m_timers.empty() && m_timers.front().timepoint <= details::now()))
+                return true;
+
+            m_sleeping_count.fetch_add(1, std::memory_order::relaxed);
+            if (m_timers.empty())
+            {
+                m_cv.wait(lock);
+            }
+            else
+            {
+                const auto timepoint = m_timers.front().timepoint;
+                m_cv.wait_until(lock, timepoint);
+            }
+            m_sleeping_count.fetch_sub(1, std::memory_order::relaxed);
+
+            return !m_stopped;
+        }
+
+    private:
+        inline static thread_local state_t* s_current_state{};
+        inline static thread_local size_t   s_current_index{};
+
+        std::vector<details::work_stealing_deque<strand>> m_deques;
+        std::atomic<size_t>                               m_sleeping_count{};
+
+        std::mutex               m_mutex{};
+        std::condition_variable  m_cv{};
+        std::deque<strand*>      m_shared{};
+        std::vector<timer_entry> m_timers{};
+        bool                     m_stopped{};
+    };
+
+    class owner_t
+    {
+    public:
+        explicit owner_t(size_t threads_count)
+            : m_state{std::make_shared<state_t>(threads_count)}
+        {
+            m_threads.reserve(threads_count);
+            for (size_t i = 0; i < threads_count; ++i)
+                m_threads.emplace_back([state = m_state, i] { state->run(i); });
+        }
+
+        owner_t(const owner_t&) = delete;
+        owner_t(owner_t&&)      = delete;
+
+        ~owner_t()
+        {
+            m_state->stop();
+            for (auto& thread : m_threads)
+            {
+                if (thread.get_id() != std::this_thread::get_id())
+                    thread.join();
+                else
+                    thread.detach();
+            }
+        }
+
+        state_t& get_state() const { return *m_state; }
+
+    private:
+        std::shared_ptr<state_t> m_state;
+        std::vector<std::thread> m_threads{};
+    };
+
+    class worker_strategy;
+
+    class strand final : public rpp::details::base_disposable
+        , public std::enable_shared_from_this<strand>
+    {
+        enum class status : uint8_t
+        {
+            idle,    // no any schedulables
+            waiting, // all schedulables are delayed, waiting for timer
+            queued   // placed to one of queues of thread pool or running right now
+        };
+
+        static constexpr size_t max_batch_size = 64;
+
+    public:
+        explicit strand(std::shared_ptr<owner_t> owner)
+            : m_owner{std::move(owner)}
+        {
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void defer_at(time_point timepoint, Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            if (is_disposed())
+                return;
+
+            std::unique_lock lock{m_mutex};
+            m_queue.emplace(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            if (m_status == status::queued || (m_status == status::waiting && !(timepoint < m_waiting_timepoint)))
+                return;
+
+            if (!m_self)
+                m_self = shared_from_this();
+            schedule_unsafe(lock);
+        }
+
+        /**
+         * @brief Executes batch of ready schedulables.
+         * @return true if strand still has ready schedulables and should be placed to queue again
+         */
+        bool run()
+        {
+            [[maybe_unused]] const details::now_batch_scope now_scope{};
+            std::unique_lock                                lock{m_mutex};
+            for (size_t i = 0; i < max_batch_size; ++i)
+            {
+                if (is_disposed() || m_queue.is_empty())
+                {
+                    m_status  = status::idle;
+                    auto self = std::move(m_self);
+                    lock.unlock();
+                    return false;
+                }
+
+                if (m_queue.top()->is_disposed())
+                {
+                    auto top = m_queue.pop();
+                    lock.unlock();
+                    top.reset();
+                    lock.lock();
+                    continue;
+                }
+
+                if (details::now() < m_queue.top()->get_timepoint())
+                {
+                    schedule_unsafe(lock);
+                    return false;
+                }
+
+                auto top = m_queue.pop();
+                lock.unlock();
+
+                if (const auto timepoint = execute(*top))
+                {
+                    lock.lock();
+                    m_queue.emplace(timepoint.value(), std::move(top));
+                }
+                else
+                {
+                    top.reset();
+                    lock.lock();
+                }
+            }
+            return true;
+        }
+
+        bool wake_by_timer(size_t generation)
+        {
+            std::lock_guard lock{m_mutex};
+            if (m_status != status::waiting || m_generation != generation)
+                return false;
+
+            m_status = status::queued;
+            return true;
+        }
+
+    private:
+        static std::optional<time_point> execute(details::schedulable_base& schedulable)
+        {
+            // current_thread's schedulables should be executed before next schedulable of this strand
+            const auto drain_on_exit = current_thread::own_queue_and_drain_finally_if_not_owned();
+            return schedulable();
+        }
+
+        void schedule_unsafe(std::unique_lock<std::mutex>& lock)
+        {
+            ++m_generation;
+            const auto timepoint = m_queue.top()->get_timepoint();
+            if (timepoint <= details::now())
+            {
+                m_status = status::queued;
+                lock.unlock();
+                m_owner->get_state().submit(this);
+                return;
+            }
+
+            m_status            = status::waiting;
+            m_waiting_timepoint = timepoint;
+            const auto generation = m_generation;
+            lock.unlock();
+            m_owner->get_state().submit_at(timepoint, weak_from_this(), generation);
+        }
+
+        void dispose_impl() noexcept override
+        {
+            std::shared_ptr<strand>                      self{};
+            details::schedulables_queue<worker_strategy> queue{m_pool};
+            {
+                std::lock_guard lock{m_mutex};
+                std::swap(queue, m_queue);
+                // queued strand would be released by thread of pool
+                if (m_status == status::waiting)
+                {
+                    m_status = status::idle;
+                    ++m_generation;
+                    self = std::move(m_self);
+                }
+            }
+        }
+
+    private:
+        std::shared_ptr<owner_t>                     m_owner;
+        std::mutex                                   m_mutex{};
+        details::schedulables_pool                   m_pool{};
+        details::schedulables_queue<worker_strategy> m_queue{m_pool};
+        // keeps strand alive while it has schedulables
+        std::shared_ptr<strand> m_self{};
+        time_point              m_waiting_timepoint{};
+        size_t                  m_generation{};
+        status                  m_status{status::idle};
+    };
+
+    class worker_strategy
+    {
+    public:
+        explicit worker_strategy(const std::shared_ptr<owner_t>& owner)
+            : m_strand{std::make_shared<strand>(owner)}
+        {
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void defer_for(duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            m_strand->defer_at(now() + duration, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        rpp::disposable_wrapper get_disposable() const { return rpp::disposable_wrapper{m_strand}; }
+
+        static rpp::schedulers::time_point now() { return details::now(); }
+
+    private:
+        std::shared_ptr<strand> m_strand;
+    };
+
+public:
+    /**
+     * @param threads_count amount of threads in pool. Zero means `std::thread::hardware_concurrency()`
+     */
+    explicit thread_pool(size_t threads_count = 0)
+        : m_owner{std::make_shared<owner_t>(threads_count ? threads_count : std::max(1u, std::thread::hardware_concurrency()))}
+    {
+    }
+
+    rpp::schedulers::worker<worker_strategy> create_worker() const
+    {
+        return rpp::schedulers::worker<worker_strategy>{m_owner};
+    }
+
+private:
+    std::shared_ptr<owner_t> m_owner;
+};
+} // namespace rpp::schedulers
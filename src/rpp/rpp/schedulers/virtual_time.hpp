@@ -0,0 +1,193 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+
+namespace rpp::schedulers
+{
+/**
+ * @brief Scheduler with virtual clock: schedulables are executed only when time is advanced manually via `advance_to`/`advance_by`/`run_all` without any real waiting.
+ *
+ * @details It allows to replay pipelines with long `interval`/`delay`/`debounce` over hours of virtual time in a fraction of real time, for example, for backtesting over recorded data or for deterministic benchmarks and tests.
+ * Advancing of time executes all schedulables due till provided time_point in order of time_point and insertion. Clock of scheduler is set to time_point of each schedulable right before its execution, so, everything observes exact virtual time of the event.
+ *
+ * Workers don't provide own disposables: whole pipelines share one scheduler, so, schedulables are cancelled only via their handlers (the same as for `current_thread`).
+ *
+ * `now()` of workers of this scheduler (used by operators to calculate timepoints) is static, so, it returns clock of the virtual_time scheduler lastly created or advanced in the current thread (or `time_point{}` if there is none). As a result, scheduler is expected to be used from one thread and one scheduler per thread at a time.
+ *
+ * @par Example
+ * \code{.cpp}
+ * rpp::schedulers::virtual_time scheduler{};
+ * rpp::source::interval(std::chrono::minutes{1}, scheduler)
+ *     | rpp::operators::subscribe([](size_t v) { std::cout << v << " "; });
+ *
+ * scheduler.advance_by(std::chrono::hours{1}); // prints 0 ... 59 immediately
+ * \endcode
+ *
+ * @ingroup schedulers
+ */
+class virtual_time final
+{
+    class worker_strategy;
+
+    class state_t final
+    {
+    public:
+        explicit state_t(const time_point& start)
+            : m_now{start}
+        {
+            activate();
+        }
+
+        state_t(const state_t&) = delete;
+        state_t(state_t&&)      = delete;
+
+        ~state_t() noexcept
+        {
+            if (s_active == this)
+                s_active = nullptr;
+        }
+
+        static const state_t* get_active() { return s_active; }
+
+        void activate() { s_active = this; }
+
+        time_point get_now() const { return m_now; }
+
+        template<typename... Args>
+        void emplace(const time_point& timepoint, Args&&... args)
+        {
+            m_queue.emplace(timepoint, std::forward<Args>(args)...);
+        }
+
+        bool is_empty() const { return m_queue.is_empty(); }
+
+        std::optional<time_point> get_next_timepoint()
+        {
+            // disposed schedulables are not going to be executed, so, they should not move clock
+            while (!m_queue.is_empty() && m_queue.top()->is_disposed())
+                m_queue.pop();
+
+            if (m_queue.is_empty())
+                return std::nullopt;
+            return m_queue.top()->get_timepoint();
+        }
+
+        void advance_to(const time_point& timepoint)
+        {
+            activate();
+
+            while (!m_queue.is_empty() && m_queue.top()->get_timepoint() <= timepoint)
+            {
+                auto top = m_queue.pop();
+                if (top->is_disposed())
+                    continue;
+
+                m_now = std::max(m_now, top->get_timepoint());
+                if (const auto next = (*top)())
+                    emplace(std::max(m_now, next.value()), std::move(top));
+            }
+
+            m_now = std::max(m_now, timepoint);
+        }
+
+    private:
+        inline static thread_local const state_t* s_active{};
+
+        time_point                                   m_now;
+        details::schedulables_pool                   m_pool{};
+        details::schedulables_queue<worker_strategy> m_queue{m_pool};
+    };
+
+    class worker_strategy
+    {
+    public:
+        worker_strategy(const std::weak_ptr<state_t>& state)
+            : m_state{state}
+        {
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void defer_for(duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            if (handler.is_disposed())
+                return;
+
+            if (const auto shared = m_state.lock())
+                shared->emplace(shared->get_now() + duration, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        static constexpr rpp::schedulers::details::none_disposable get_disposable() { return {}; }
+
+        static rpp::schedulers::time_point now()
+        {
+            const auto* active = state_t::get_active();
+            return active ? active->get_now() : time_point{};
+        }
+
+    private:
+        std::weak_ptr<state_t> m_state;
+    };
+
+public:
+    /**
+     * @param start initial time_point of virtual clock
+     */
+    explicit virtual_time(const time_point& start = time_point{})
+        : m_state{std::make_shared<state_t>(start)}
+    {
+    }
+
+    /**
+     * @brief Current time_point of virtual clock of this scheduler
+     */
+    time_point now() const { return m_state->get_now(); }
+
+    /**
+     * @brief Executes all schedulables due till provided time_point (including schedulables scheduled during this advancing) and moves clock to it. Clock never goes backwards.
+     */
+    void advance_to(const time_point& timepoint) const { m_state->advance_to(timepoint); }
+
+    /**
+     * @brief Same as `advance_to(now() + duration)`
+     */
+    void advance_by(duration duration) const { m_state->advance_to(now() + duration); }
+
+    /**
+     * @brief Advances clock till queue of schedulables becomes empty.
+     * @warning Never returns in case of endless periodic schedulables (like `interval` without any `take`)
+     */
+    void run_all() const
+    {
+        while (const auto timepoint = m_state->get_next_timepoint())
+            m_state->advance_to(timepoint.value());
+    }
+
+    bool is_empty() const { return m_state->is_empty(); }
+
+    rpp::schedulers::worker<worker_strategy> create_worker() const
+    {
+        m_state->activate();
+        return rpp::schedulers::worker<worker_strategy>{m_state};
+    }
+
+private:
+    std::shared_ptr<state_t> m_state;
+};
+} // namespace rpp::schedulers
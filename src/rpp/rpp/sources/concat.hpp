@@ -17,8 +17,10 @@
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/sources/from.hpp>
 
+#include <array>
 #include <exception>
 #include <optional>
+#include <type_traits>
 
 namespace rpp::details
 {
@@ -97,6 +99,44 @@ void drain(TObserver&& obs, const TWorker& worker, PackedContainer&& container,
         observable->subscribe(observer<value_type, concat_source_observer_strategy<TWorker, std::decay_t<TObserver>, std::decay_t<PackedContainer>>>{std::forward<TObserver>(obs), std::forward<PackedContainer>(container), worker, index});
 }
 
+template<typename PackedContainer>
+struct concat_static_size
+{
+};
+
+template<typename T, size_t N>
+struct concat_static_size<std::array<T, N>> : std::integral_constant<size_t, N>
+{
+};
+
+template<typename T, size_t N>
+struct concat_static_size<shared_container<std::array<T, N>>> : std::integral_constant<size_t, N>
+{
+};
+
+/**
+ * @brief Observer obtains disposable of worker and disposables of each inner observable, so, amount of disposables is known only in case of amount of inner observables is known or inner observables have no disposables at all.
+ */
+template<rpp::schedulers::constraint::scheduler TScheduler, constraint::decayed_type PackedContainer>
+auto* deduce_concat_disposable_strategy()
+{
+    using worker_strategy = observables::fixed_disposable_strategy_selector<rpp::schedulers::utils::get_worker_t<TScheduler>::is_none_disposable ? 0 : 1>;
+    using inner_strategy  = observables::deduce_disposable_strategy_t<utils::iterable_value_t<PackedContainer>>;
+    using inner_traits    = observables::details::fixed_disposable_strategy_traits<inner_strategy>;
+
+    if constexpr (requires { concat_static_size<PackedContainer>::value; })
+        return static_cast<observables::combined_disposable_strategy_t<1, worker_strategy, observables::combined_disposable_strategy_t<concat_static_size<PackedContainer>::value, inner_strategy>>*>(nullptr);
+    else if constexpr (inner_traits::is_fixed)
+    {
+        if constexpr (inner_traits::count == 0)
+            return static_cast<observables::combined_disposable_strategy_t<1, worker_strategy, inner_strategy>*>(nullptr);
+        else
+            return static_cast<observables::default_disposable_strategy_selector*>(nullptr);
+    }
+    else
+        return static_cast<observables::default_disposable_strategy_selector*>(nullptr);
+}
+
 template<rpp::schedulers::constraint::scheduler TScheduler, constraint::decayed_type PackedContainer>
 struct concat_strategy
 {
@@ -111,7 +151,11 @@ struct concat_strategy
     RPP_NO_UNIQUE_ADDRESS PackedContainer container;
     RPP_NO_UNIQUE_ADDRESS TScheduler scheduler;
 
-    using value_type = rpp::utils::extract_observable_type_t<utils::iterable_value_t<PackedContainer>>;
+    using value_type                   = rpp::utils::extract_observable_type_t<utils::iterable_value_t<PackedContainer>>;
+    using expected_disposable_strategy = std::remove_pointer_t<decltype(deduce_concat_disposable_strategy<TScheduler, PackedContainer>())>;
+
+    // disposables of inner observables are passed to observer as is
+    static constexpr bool is_requestable = rpp::constraint::requestable_observable<utils::iterable_value_t<PackedContainer>>;
 
     template<constraint::observer_strategy<value_type> Strategy>
     void subscribe(observer<value_type, Strategy>&& obs) const
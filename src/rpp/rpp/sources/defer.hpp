@@ -22,6 +22,8 @@ struct defer_strategy
     using value_type = rpp::utils::extract_observable_type_t<std::invoke_result_t<Factory>>;
     using expected_disposable_strategy = rpp::details::observables::deduce_disposable_strategy_t<std::invoke_result_t<Factory>>;
 
+    static constexpr bool is_requestable = rpp::constraint::requestable_observable<std::invoke_result_t<Factory>>;
+
     RPP_NO_UNIQUE_ADDRESS Factory observable_factory;
 
     template<rpp::constraint::observer_of_type<value_type> TObs>
@@ -21,6 +21,8 @@ struct error_strategy
     using value_type = Type;
     using expected_disposable_strategy = rpp::details::observables::bool_disposable_strategy_selector;
 
+    static constexpr bool is_synchronous = true;
+
     std::exception_ptr err{};
 
     void subscribe(const auto& obs) const { obs.on_error(err); }
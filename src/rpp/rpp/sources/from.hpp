@@ -12,12 +12,15 @@
 #include <rpp/sources/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/disposables/interface_requestable_disposable.hpp>
 #include <rpp/observables/observable.hpp>
 #include <rpp/operators/map.hpp>
 #include <rpp/schedulers/current_thread.hpp>
 #include <rpp/utils/utils.hpp>
 
 #include <array>
+#include <atomic>
 #include <exception>
 #include <memory>
 #include <type_traits>
@@ -87,6 +90,8 @@ public:
     using value_type = rpp::utils::iterable_value_t<PackedContainer>;
     using expected_disposable_strategy = std::conditional_t<rpp::schedulers::utils::get_worker_t<TScheduler>::is_none_disposable, rpp::details::observables::bool_disposable_strategy_selector, rpp::details::observables::fixed_disposable_strategy_selector<1>>;
 
+    static constexpr bool is_synchronous = std::same_as<TScheduler, schedulers::immediate>;
+
     template<typename... Args>
     from_iterable_strategy(const TScheduler& scheduler, Args&&... args)
         : container{std::forward<Args>(args)...}
@@ -133,6 +138,184 @@ public:
     }
 };
 
+/**
+ * @brief State of `from_iterable_on_demand`: emits items of container only when they were requested via rpp::interface_requestable_disposable::request.
+ *
+ * @details Requests and emissions are serialized via "work in progress" counter: thread which moves it from zero schedules draining of items to worker, any other request just increases counter to notify draining loop about new demand. So, request from inside of `on_next` doesn't cause recursion.
+ */
+template<constraint::decayed_type PackedContainer, rpp::constraint::observer Observer, rpp::schedulers::constraint::worker TWorker>
+class from_iterable_on_demand_state final : public rpp::interface_requestable_disposable
+    , public std::enable_shared_from_this<from_iterable_on_demand_state<PackedContainer, Observer, TWorker>>
+{
+    struct handler
+    {
+        std::shared_ptr<from_iterable_on_demand_state> state;
+
+        bool is_disposed() const { return state->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { state->m_observer.on_error(err); }
+    };
+
+public:
+    from_iterable_on_demand_state(const PackedContainer& container, Observer&& observer, TWorker&& worker)
+        : m_container{container}
+        , m_observer{std::move(observer)}
+        , m_worker{std::move(worker)}
+        , m_itr{std::cbegin(m_container)}
+    {
+    }
+
+    void start()
+    {
+        // state keeps itself alive till termination/disposing. Observer obtains only weak reference to avoid cycle
+        m_self = this->shared_from_this();
+        m_observer.set_upstream(rpp::disposable_wrapper::from_weak(m_self));
+
+        // nobody enabled backpressure during set_upstream
+        size_t expected{};
+        m_requested.compare_exchange_strong(expected, unbounded, std::memory_order::relaxed);
+
+        // "work in progress" is owned by `start` since construction, so, requests from inside of set_upstream can't start emissions too early
+        schedule_drain();
+    }
+
+    void request(size_t count) noexcept override
+    {
+        if (count == 0)
+            return;
+
+        size_t current = m_requested.load(std::memory_order::relaxed);
+        while (current != unbounded && !m_requested.compare_exchange_weak(current, unbounded - current > count ? current + count : unbounded, std::memory_order::release, std::memory_order::relaxed))
+        {
+        }
+
+        if (m_wip.fetch_add(1, std::memory_order::acq_rel) == 0)
+            schedule_drain();
+    }
+
+    bool is_disposed() const noexcept override { return m_disposed.load(std::memory_order::acquire); }
+
+    void dispose() noexcept override
+    {
+        if (m_disposed.exchange(true, std::memory_order::acq_rel))
+            return;
+
+        if constexpr (!TWorker::is_none_disposable)
+            m_worker.get_disposable().dispose();
+
+        // only one thread can reach this line, so, no race over m_self
+        const auto self = std::move(m_self);
+    }
+
+private:
+    void schedule_drain() noexcept
+    {
+        try
+        {
+            m_worker.schedule([](const handler& h) -> rpp::schedulers::optional_delay_from_now {
+                h.state->drain();
+                return std::nullopt;
+            },
+                              handler{this->shared_from_this()});
+        }
+        catch (...)
+        {
+            m_observer.on_error(std::current_exception());
+        }
+    }
+
+    void drain()
+    {
+        size_t missed = 1;
+        while (true)
+        {
+            const size_t requested = m_requested.load(std::memory_order::acquire);
+            size_t       emitted{};
+            try
+            {
+                for (; m_itr != std::cend(m_container); ++m_itr)
+                {
+                    if (is_disposed() || m_observer.is_disposed())
+                        return;
+                    if (emitted == requested)
+                        break;
+
+                    m_observer.on_next(utils::as_const(*m_itr));
+                    ++emitted;
+                }
+            }
+            catch (...)
+            {
+                dispose();
+                m_observer.on_error(std::current_exception());
+                return;
+            }
+
+            // completion doesn't need demand
+            if (m_itr == std::cend(m_container))
+            {
+                if (!is_disposed())
+                {
+                    dispose();
+                    m_observer.on_completed();
+                }
+                return;
+            }
+
+            if (requested != unbounded)
+                m_requested.fetch_sub(emitted, std::memory_order::relaxed);
+
+            missed = m_wip.fetch_sub(missed, std::memory_order::acq_rel) - missed;
+            if (missed == 0)
+                return;
+        }
+    }
+
+private:
+    RPP_NO_UNIQUE_ADDRESS PackedContainer                                      m_container;
+    RPP_NO_UNIQUE_ADDRESS Observer                                             m_observer;
+    RPP_NO_UNIQUE_ADDRESS TWorker                                              m_worker;
+    decltype(std::cbegin(std::declval<const PackedContainer&>()))              m_itr;
+    std::shared_ptr<from_iterable_on_demand_state>                             m_self{};
+    std::atomic<size_t>                                                        m_requested{};
+    std::atomic<size_t>                                                        m_wip{1};
+    std::atomic_bool                                                           m_disposed{};
+};
+
+template<constraint::decayed_type PackedContainer, schedulers::constraint::scheduler TScheduler>
+struct from_iterable_on_demand_strategy
+{
+public:
+    using value_type                   = rpp::utils::iterable_value_t<PackedContainer>;
+    using expected_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+    static constexpr bool is_requestable = true;
+
+    template<typename... Args>
+    from_iterable_on_demand_strategy(const TScheduler& scheduler, Args&&... args)
+        : container{std::forward<Args>(args)...}
+        , scheduler{scheduler}
+    {
+    }
+
+    RPP_NO_UNIQUE_ADDRESS PackedContainer container;
+    RPP_NO_UNIQUE_ADDRESS TScheduler      scheduler;
+
+    template<constraint::observer_strategy<value_type> Strategy>
+    void subscribe(observer<value_type, Strategy>&& obs) const
+    {
+        using state_t = from_iterable_on_demand_state<PackedContainer, observer<value_type, Strategy>, rpp::schedulers::utils::get_worker_t<TScheduler>>;
+        std::make_shared<state_t>(container, std::move(obs), scheduler.create_worker())->start();
+    }
+};
+
+template<typename PackedContainer, schedulers::constraint::scheduler TScheduler, typename... Args>
+auto make_from_iterable_on_demand_observable(const TScheduler& scheduler, Args&&... args)
+{
+    return observable<utils::iterable_value_t<std::decay_t<PackedContainer>>,
+                      details::from_iterable_on_demand_strategy<std::decay_t<PackedContainer>, TScheduler>>{scheduler, std::forward<Args>(args)...};
+}
+
 template<typename PackedContainer, schedulers::constraint::scheduler TScheduler, typename... Args>
 auto make_from_iterable_observable(const TScheduler& scheduler, Args&&... args)
 {
@@ -247,6 +430,59 @@ auto just(T&& item, Ts&&... items)
     return details::make_from_iterable_observable<container>(rpp::schedulers::defaults::iteration_scheduler{}, std::forward<T>(item), std::forward<Ts>(items)...);
 }
 
+/**
+ * @brief Same as rpp::source::from_iterable, but supports backpressure: it emits items only when they were requested by observer.
+ *
+ * @details Observable passes rpp::interface_requestable_disposable to observer via `set_upstream`. If observer (or any operator in the chain, like rpp::operators::observe_on) requests some items via `request(n)` during `set_upstream`, then observable emits only requested amount of items and waits for next requests. Otherwise it emits all items without limits like rpp::source::from_iterable does.
+ * @details Items are emitted in batches (as much as requested) from one schedulable of scheduler.
+ *
+ * @marble from_iterable_on_demand
+   {
+       operator "from_iterable_on_demand({1,2,3,5})": +-1-2-3-5-|
+   }
+ *
+ * @par Performance notes:
+ * - 1 heap allocation for state per subscription
+ *
+ * @tparam memory_model rpp::memory_model strategy used to handle provided iterable
+ * @param scheduler is scheduler used for scheduling of submissions: batch of requested items is emitted from one schedulable
+ * @param iterable container with values which will be flattened
+ *
+ * @ingroup creational_operators
+ * @see https://reactivex.io/documentation/operators/from.html
+ */
+template<constraint::memory_model MemoryModel /* = memory_model::use_stack*/, constraint::iterable Iterable, schedulers::constraint::scheduler TScheduler /* = rpp::schedulers::defaults::iteration_scheduler*/>
+auto from_iterable_on_demand(Iterable&& iterable, const TScheduler& scheduler /* = TScheduler{}*/)
+{
+    using container = std::conditional_t<std::same_as<MemoryModel, rpp::memory_model::use_stack>, std::decay_t<Iterable>, details::shared_container<std::decay_t<Iterable>>>;
+    return details::make_from_iterable_on_demand_observable<container>(scheduler, std::forward<Iterable>(iterable));
+}
+
+/**
+ * @brief Same as rpp::source::just, but supports backpressure the same way as rpp::source::from_iterable_on_demand
+ *
+ * @marble just_on_demand
+   {
+       operator "just_on_demand(1,2,3,5)": +-1-2-3-5-|
+   }
+ *
+ * @tparam memory_model rpp::memory_model startegy used to handle provided items
+ * @param scheduler is scheduler used for scheduling of submissions: batch of requested items is emitted from one schedulable
+ * @param item first value to be sent
+ * @param items rest values to be sent
+ *
+ * @ingroup creational_operators
+ * @see https://reactivex.io/documentation/operators/just.html
+ */
+template<constraint::memory_model MemoryModel /* = memory_model::use_stack */, schedulers::constraint::scheduler TScheduler, typename T, typename... Ts>
+    requires (constraint::decayed_same_as<T, Ts> && ...)
+auto just_on_demand(const TScheduler& scheduler, T&& item, Ts&&... items)
+{
+    using inner_container = std::array<std::decay_t<T>, sizeof...(Ts) + 1>;
+    using container       = std::conditional_t<std::same_as<MemoryModel, rpp::memory_model::use_stack>, inner_container, details::shared_container<inner_container>>;
+    return details::make_from_iterable_on_demand_observable<container>(scheduler, std::forward<T>(item), std::forward<Ts>(items)...);
+}
+
 /**
  * @brief Creates rpp::specific_observable that calls provided callable and emits resulting value of this callable
  *
@@ -49,6 +49,13 @@ template<constraint::memory_model MemoryModel = memory_model::use_stack, schedul
     requires (constraint::decayed_same_as<T, Ts> && ...)
 auto just(const TScheduler& scheduler, T&& item, Ts&&... items);
 
+template<constraint::memory_model MemoryModel = memory_model::use_stack, constraint::iterable Iterable, schedulers::constraint::scheduler TScheduler = rpp::schedulers::defaults::iteration_scheduler>
+auto from_iterable_on_demand(Iterable&& iterable, const TScheduler& scheduler = TScheduler{});
+
+template<constraint::memory_model MemoryModel = memory_model::use_stack, schedulers::constraint::scheduler TScheduler, typename T, typename... Ts>
+    requires (constraint::decayed_same_as<T, Ts> && ...)
+auto just_on_demand(const TScheduler& scheduler, T&& item, Ts&&... items);
+
 template<constraint::memory_model MemoryModel = memory_model::use_stack, std::invocable<> Callable>
 auto from_callable(Callable&& callable);
 
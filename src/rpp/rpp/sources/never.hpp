@@ -21,6 +21,8 @@ struct never_strategy
     using value_type = Type;
     using expected_disposable_strategy = rpp::details::observables::bool_disposable_strategy_selector;
 
+    static constexpr bool is_synchronous = true;
+
     static void subscribe(const auto&) {}
 };
 }
@@ -17,4 +17,8 @@
  * \ingroup rpp
  */
 
-#include <rpp/subjects/publish_subject.hpp>
\ No newline at end of file
+#include <rpp/subjects/async_subject.hpp>
+#include <rpp/subjects/behavior_subject.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+#include <rpp/subjects/replay_subject.hpp>
+#include <rpp/subjects/serialized_subject.hpp>
\ No newline at end of file
@@ -0,0 +1,116 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/subjects/fwd.hpp>
+
+#include <rpp/observers/observer.hpp>
+#include <rpp/subjects/details/base_subject.hpp>
+#include <rpp/subjects/details/replaying_observer.hpp>
+#include <rpp/subjects/details/subject_state.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <utility>
+
+namespace rpp::subjects::details
+{
+template<rpp::constraint::decayed_type Type>
+class async_strategy
+{
+    struct value_state
+    {
+        // guards only cached value: observers are never called under it
+        std::mutex          mutex{};
+        std::optional<Type> value{};
+        bool                is_completed{};
+        bool                is_terminated{};
+        // incremented once on completion: completion is the only emission of value
+        std::atomic<size_t> sequence{};
+    };
+
+    struct observer_strategy
+    {
+        std::shared_ptr<subject_state<Type>> state{};
+        std::shared_ptr<value_state>         value{};
+
+        void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
+
+        bool is_disposed() const noexcept { return state->is_disposed(); }
+
+        void on_next(const Type& v) const
+        {
+            std::lock_guard lock{value->mutex};
+            if (!value->is_terminated)
+                value->value = v;
+        }
+
+        void on_error(const std::exception_ptr& err) const
+        {
+            {
+                std::lock_guard lock{value->mutex};
+                if (value->is_terminated)
+                    return;
+
+                value->is_terminated = true;
+                value->value.reset();
+            }
+            state->on_error(err);
+        }
+
+        void on_completed() const
+        {
+            {
+                std::lock_guard lock{value->mutex};
+                if (value->is_terminated)
+                    return;
+
+                value->is_terminated = true;
+                value->is_completed  = true;
+                value->sequence.fetch_add(1, std::memory_order::release);
+            }
+            // value is never modified after termination, so, it is safe to read it without lock
+            if (value->value)
+                state->on_next(value->value.value());
+            state->on_completed();
+        }
+    };
+
+public:
+    using expected_disposable_strategy = rpp::details::observables::deduce_disposable_strategy_t<subject_state<Type>>;
+
+    auto get_observer() const
+    {
+        return rpp::observer<Type, rpp::details::with_external_disposable<observer_strategy>>{composite_disposable_wrapper{m_state}, observer_strategy{m_state, m_value}};
+    }
+
+    template<rpp::constraint::observer_of_type<Type> TObs>
+    void on_subscribe(TObs&& observer) const
+    {
+        subscribe_with_replay(*m_state, m_value->mutex, std::shared_ptr<const std::atomic<size_t>>{m_value, &m_value->sequence}, std::forward<TObs>(observer), [&] {
+            // value is never modified after completion, so, it can be replayed by reference
+            const Type* snapshot = m_value->is_completed && m_value->value ? &m_value->value.value() : nullptr;
+            return std::pair{std::span<const Type>{snapshot, snapshot ? size_t{1} : size_t{0}}, m_value->sequence.load(std::memory_order::relaxed)};
+        });
+    }
+
+    rpp::disposable_wrapper get_disposable() const
+    {
+        return rpp::disposable_wrapper{m_state};
+    }
+
+private:
+    std::shared_ptr<subject_state<Type>> m_state = std::make_shared<subject_state<Type>>();
+    std::shared_ptr<value_state>         m_value = std::make_shared<value_state>();
+};
+} // namespace rpp::subjects::details
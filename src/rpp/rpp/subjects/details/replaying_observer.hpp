@@ -0,0 +1,212 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/observers/observer.hpp>
+#include <rpp/subjects/details/subject_state.hpp>
+#include <rpp/utils/functors.hpp>
+#include <rpp/utils/ring_buffer.hpp>
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <variant>
+
+namespace rpp::subjects::details
+{
+/**
+ * @brief State of observer subscribed to subject with cached values (behavior/replay/async subjects). It lets subject replay its cache without holding any lock while calling observer.
+ *
+ * @details Subject registers observer in subject_state first and only then takes snapshot of its cache together with current sequence number `S`. While snapshot is being delivered, live emissions are queued together with their sequence numbers. Then queued values with sequence number `<= S` are skipped as already delivered via snapshot, others are delivered and observer switches to direct delivering of live emissions. Emission cached before taking of snapshot can still be in flight at this moment, so, live emissions with sequence number `<= S` are skipped too.
+ *
+ * @warning Subject has to increment sequence number before passing value to subject_state. Emissions are expected to be serialized (as required by observable contract), so, sequence number read during queueing is the one of queued value.
+ */
+template<rpp::constraint::decayed_type Type>
+class replaying_observer_state
+{
+    struct queued_value
+    {
+        size_t sequence;
+        Type   value;
+    };
+
+    using terminal_t = std::variant<std::monostate, std::exception_ptr, completed>;
+
+public:
+    replaying_observer_state(rpp::dynamic_observer<Type>&& observer, std::shared_ptr<const std::atomic<size_t>> sequence)
+        : m_observer{std::move(observer)}
+        , m_sequence{std::move(sequence)}
+    {
+    }
+
+    void set_upstream(const disposable_wrapper& d) noexcept { m_observer.set_upstream(d); }
+
+    bool is_disposed() const noexcept { return m_observer.is_disposed(); }
+
+    void on_next(const Type& v)
+    {
+        const auto sequence = m_sequence->load(std::memory_order::acquire);
+        if (!m_is_live.load(std::memory_order::acquire))
+        {
+            std::unique_lock lock{m_mutex};
+            if (!m_is_live.load(std::memory_order::relaxed))
+            {
+                m_queue.push_back(queued_value{sequence, v});
+                return;
+            }
+        }
+        // emission cached before taking of snapshot could reach observer only after replaying of snapshot
+        if (sequence > m_replayed_sequence)
+            m_observer.on_next(v);
+    }
+
+    void on_error(const std::exception_ptr& err)
+    {
+        if (!m_is_live.load(std::memory_order::acquire))
+        {
+            std::unique_lock lock{m_mutex};
+            if (!m_is_live.load(std::memory_order::relaxed))
+            {
+                m_terminal = err;
+                return;
+            }
+        }
+        m_observer.on_error(err);
+    }
+
+    void on_completed()
+    {
+        if (!m_is_live.load(std::memory_order::acquire))
+        {
+            std::unique_lock lock{m_mutex};
+            if (!m_is_live.load(std::memory_order::relaxed))
+            {
+                m_terminal = completed{};
+                return;
+            }
+        }
+        m_observer.on_completed();
+    }
+
+    /**
+     * @brief Delivers snapshot of cache
+     */
+    void replay(const std::optional<Type>& snapshot) const
+    {
+        if (snapshot)
+            m_observer.on_next(snapshot.value());
+    }
+
+    template<std::ranges::range Snapshot>
+    void replay(const Snapshot& snapshot) const
+    {
+        for (const auto& v : snapshot)
+            m_observer.on_next(v);
+    }
+
+    template<typename Snapshot>
+        requires requires(const Snapshot& snapshot) { snapshot.for_each([](const Type&) {}); }
+    void replay(const Snapshot& snapshot) const
+    {
+        snapshot.for_each([&](const Type& v) { m_observer.on_next(v); });
+    }
+
+    /**
+     * @brief Delivers emissions queued during replaying of snapshot taken at `sequence` and switches to live delivering
+     */
+    void finish_replay(size_t sequence)
+    {
+        // live emissions read it only after switching to live delivering
+        m_replayed_sequence = sequence;
+
+        while (true)
+        {
+            std::unique_lock lock{m_mutex};
+            if (m_queue.empty())
+            {
+                if (std::holds_alternative<std::monostate>(m_terminal))
+                {
+                    m_is_live.store(true, std::memory_order::release);
+                    return;
+                }
+
+                const auto terminal = std::exchange(m_terminal, std::monostate{});
+                lock.unlock();
+
+                std::visit(rpp::utils::overloaded{[&](const std::exception_ptr& err) { m_observer.on_error(err); },
+                                                  [&](completed) { m_observer.on_completed(); },
+                                                  rpp::utils::empty_function_any_t{}},
+                           terminal);
+                return;
+            }
+
+            auto queued = std::move(m_queue.front());
+            m_queue.pop_front();
+            lock.unlock();
+
+            if (queued.sequence > m_replayed_sequence)
+                m_observer.on_next(std::move(queued.value));
+        }
+    }
+
+private:
+    rpp::dynamic_observer<Type>                m_observer;
+    std::shared_ptr<const std::atomic<size_t>> m_sequence;
+
+    std::mutex                            m_mutex{};
+    rpp::utils::ring_buffer<queued_value> m_queue{};
+    terminal_t                            m_terminal{};
+    // written before switching to live delivering and never modified after that
+    size_t                                m_replayed_sequence{};
+    std::atomic_bool                      m_is_live{};
+};
+
+template<rpp::constraint::decayed_type Type>
+struct replaying_observer_strategy
+{
+    using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+    std::shared_ptr<replaying_observer_state<Type>> state;
+
+    void on_next(const Type& v) const { state->on_next(v); }
+
+    void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+    void on_completed() const { state->on_completed(); }
+
+    void set_upstream(const disposable_wrapper& d) const { state->set_upstream(d); }
+
+    bool is_disposed() const { return state->is_disposed(); }
+};
+
+/**
+ * @brief Subscribes observer to subject_state first and then replays snapshot of cache to it without holding of any lock.
+ *
+ * @param take_snapshot is called under lock guarding cache. It has to return pair of snapshot and sequence number of latest emission included into it. Snapshot is std::optional, any range of values or any type providing `for_each` over values.
+ */
+template<rpp::constraint::decayed_type Type, rpp::constraint::observer_of_type<Type> TObs, typename TakeSnapshot>
+void subscribe_with_replay(subject_state<Type>& state, std::mutex& mutex, std::shared_ptr<const std::atomic<size_t>> sequence, TObs&& observer, const TakeSnapshot& take_snapshot)
+{
+    const auto replaying = std::make_shared<replaying_observer_state<Type>>(std::forward<TObs>(observer).as_dynamic(), std::move(sequence));
+    state.on_subscribe(rpp::observer<Type, replaying_observer_strategy<Type>>{replaying});
+
+    std::unique_lock lock{mutex};
+    auto [snapshot, snapshot_sequence] = take_snapshot();
+    lock.unlock();
+
+    replaying->replay(snapshot);
+    replaying->finish_replay(snapshot_sequence);
+}
+} // namespace rpp::subjects::details
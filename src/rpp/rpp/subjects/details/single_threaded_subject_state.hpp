@@ -0,0 +1,182 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/observables/fwd.hpp>
+#include <rpp/disposables/callback_disposable.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/subjects/details/subject_state.hpp>
+#include <rpp/utils/constraints.hpp>
+#include <rpp/utils/functors.hpp>
+#include <rpp/utils/utils.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <variant>
+#include <vector>
+
+namespace rpp::subjects::details
+{
+/**
+ * @brief Same as rpp::subjects::details::subject_state, but for usage from one thread only: no locks and no atomics during emissions.
+ *
+ * @details Observers are kept in contiguous vector which is never modified during emission: observers subscribed during emission (reentrantly) are kept aside and merged once emission is finished, disposed observers are erased only when nobody emits right now.
+ * @details Subject's own disposable and disposables of observers are non-atomic as well.
+ */
+template<rpp::constraint::decayed_type Type>
+class single_threaded_subject_state final : public std::enable_shared_from_this<single_threaded_subject_state<Type>>
+    , public composite_disposable_impl<rpp::details::disposables::dynamic_disposables_container<0>, rpp::details::disposables::AtomicMode::NonAtomic>
+{
+    template<typename Fn>
+    using non_atomic_callback_disposable = rpp::callback_disposable<Fn, rpp::details::disposables::AtomicMode::NonAtomic>;
+
+    using state_t = std::variant<std::monostate, std::exception_ptr, completed, disposed>;
+
+public:
+    using expected_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+    single_threaded_subject_state() = default;
+
+    single_threaded_subject_state(const single_threaded_subject_state&) = delete;
+    single_threaded_subject_state(single_threaded_subject_state&&)      = delete;
+
+    template<rpp::constraint::observer_of_type<Type> TObs>
+    void on_subscribe(TObs&& observer)
+    {
+        std::visit(rpp::utils::overloaded{[&](std::monostate) {
+                                              auto observer_as_dynamic = std::forward<TObs>(observer).as_dynamic();
+                                              (m_emitting_depth == 0 ? m_observers : m_pending).push_back(observer_as_dynamic);
+                                              // observer could be disposed (and erased) right during setting of upstream
+                                              set_upstream(observer_as_dynamic);
+                                          },
+                                          [&](const std::exception_ptr& err) { observer.on_error(err); },
+                                          [&](completed) { observer.on_completed(); },
+                                          [](disposed) {}},
+                   m_state);
+    }
+
+    void on_next(const Type& v)
+    {
+        // observers subscribed during this emission would obtain only next values
+        const size_t pending_size = m_pending.size();
+
+        ++m_emitting_depth;
+        std::for_each(m_observers.cbegin(), m_observers.cend(), [&](const rpp::dynamic_observer<Type>& sub) { sub.on_next(v); });
+        for_each_pending(pending_size, [&](const rpp::dynamic_observer<Type>& sub) { sub.on_next(v); });
+        --m_emitting_depth;
+
+        cleanup_if_possible();
+    }
+
+    void on_error(const std::exception_ptr& err)
+    {
+        exchange_state(err, [&](const rpp::dynamic_observer<Type>& sub) { sub.on_error(err); });
+    }
+
+    void on_completed()
+    {
+        exchange_state(completed{}, rpp::utils::static_mem_fn<&dynamic_observer<Type>::on_completed>{});
+    }
+
+private:
+    void dispose_impl() noexcept override
+    {
+        exchange_state(disposed{}, rpp::utils::empty_function_any_t{});
+    }
+
+    void set_upstream(rpp::dynamic_observer<Type>& obs)
+    {
+        const auto on_disposed = [weak = this->weak_from_this()]() noexcept // NOLINT(bugprone-exception-escape)
+        {
+            if (const auto shared = weak.lock())
+                shared->on_observer_disposed();
+        };
+        obs.set_upstream(rpp::disposable_wrapper{std::make_shared<non_atomic_callback_disposable<std::decay_t<decltype(on_disposed)>>>(on_disposed)});
+    }
+
+    void on_observer_disposed()
+    {
+        ++m_disposed_count;
+        cleanup_if_possible();
+    }
+
+    template<typename Fn>
+    void exchange_state(state_t&& new_state, const Fn& fn)
+    {
+        if (!std::holds_alternative<std::monostate>(m_state))
+            return;
+
+        m_state = std::move(new_state);
+
+        ++m_emitting_depth;
+        // no new observers can be appended after terminal event
+        std::for_each(m_observers.cbegin(), m_observers.cend(), fn);
+        for_each_pending(m_pending.size(), fn);
+        --m_emitting_depth;
+
+        cleanup_if_possible();
+    }
+
+    template<typename Fn>
+    void for_each_pending(size_t count, const Fn& fn)
+    {
+        // pending observers can be relocated by reentrant subscription, so, copy is needed
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto observer = m_pending[i];
+            fn(observer);
+        }
+    }
+
+    void cleanup_if_possible()
+    {
+        if (m_emitting_depth != 0)
+            return;
+
+        if (!std::holds_alternative<std::monostate>(m_state))
+        {
+            m_observers.clear();
+            m_pending.clear();
+            return;
+        }
+
+        if (!m_pending.empty())
+        {
+            std::move(m_pending.begin(), m_pending.end(), std::back_inserter(m_observers));
+            m_pending.clear();
+        }
+
+        // erase disposed observers only when half of them are garbage to keep unsubscribe amortized O(1)
+        if (m_disposed_count != 0 && m_disposed_count * 2 >= m_observers.size())
+        {
+            // dynamic_observer is not assignable, so, compact via copying of alive observers
+            std::vector<rpp::dynamic_observer<Type>> alive{};
+            alive.reserve(m_observers.size() - std::min(m_disposed_count, m_observers.size()));
+            for (auto& observer : m_observers)
+            {
+                if (!observer.is_disposed())
+                    alive.push_back(std::move(observer));
+            }
+            m_observers.swap(alive);
+            m_disposed_count = 0;
+        }
+    }
+
+private:
+    std::vector<rpp::dynamic_observer<Type>> m_observers{};
+    std::vector<rpp::dynamic_observer<Type>> m_pending{};
+    state_t                                  m_state{};
+    size_t                                   m_emitting_depth{};
+    size_t                                   m_disposed_count{};
+};
+} // namespace rpp::subjects::details
@@ -19,6 +19,9 @@
 #include <rpp/utils/utils.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <variant>
@@ -34,63 +37,130 @@ struct disposed
 {
 };
 
+/**
+ * @brief State of subject: list of subscribed observers and terminal event (if any)
+ *
+ * @details Observers are kept in append-only block published to emitters via atomic pointer:
+ * - `on_next` never takes lock: it just iterates over published part of current block.
+ * - subscribe appends observer into free space of current block and publishes new size in O(1). Block is re-created (with 2x capacity of alive observers) only when it is full, so, subscribe is amortized O(1).
+ * - unsubscribe doesn't touch block at all: disposed observers are skipped by emissions and block is compacted only when half of its observers are disposed, so, unsubscribe is amortized O(1) too.
+ *
+ * Replaced blocks are reclaimed via epoch-based scheme: emitters register themselves in counter of current epoch before loading of block, each replacement of block advances epoch, so, new emitters go to another counter and old one drains. Emitter of any epoch can load latest block, so, retired block is destroyed only once each of counters was observed empty after its retirement. Registration never blocks and nothing waits for emitters: retired blocks are reclaimed on subscribe/unsubscribe and by the last emitter leaving its counter. Such an emitter only tries to take lock: if it is busy, reclamation is requested from current holder of lock, so, disposed observers are destroyed even if nobody subscribes/unsubscribes anymore.
+ */
 template<rpp::constraint::decayed_type Type>
 class subject_state final : public std::enable_shared_from_this<subject_state<Type>>
     , public composite_disposable
 {
-    using shared_observers = std::shared_ptr<std::vector<rpp::dynamic_observer<Type>>>;
-    using state_t          = std::variant<shared_observers, std::exception_ptr, completed, disposed>;
+    class observers_block
+    {
+    public:
+        explicit observers_block(size_t capacity)
+        {
+            m_observers.reserve(capacity);
+            m_data = m_observers.data();
+        }
+
+        bool is_full() const { return m_observers.size() == m_observers.capacity(); }
+
+        // only for writers under lock
+        const std::vector<rpp::dynamic_observer<Type>>& get_observers() const { return m_observers; }
+
+        void push_back(const rpp::dynamic_observer<Type>& observer)
+        {
+            // capacity is reserved, so, already published observers are never relocated
+            m_observers.push_back(observer);
+            m_published_size.store(m_observers.size(), std::memory_order::release);
+        }
+
+        template<typename Fn>
+        void for_each(const Fn& fn) const
+        {
+            const auto size = m_published_size.load(std::memory_order::acquire);
+            std::for_each(m_data, m_data + size, fn);
+        }
+
+    private:
+        std::vector<rpp::dynamic_observer<Type>> m_observers{};
+        const rpp::dynamic_observer<Type>*       m_data{};
+        std::atomic<size_t>                      m_published_size{};
+    };
+
+    struct retired_block
+    {
+        // emitters which could load this block are registered in counters non-empty at the moment of retirement
+        std::array<bool, 2>              drained{};
+        std::unique_ptr<observers_block> block;
+    };
+
+    using retired_blocks = std::vector<std::unique_ptr<observers_block>>;
+    using state_t        = std::variant<std::monostate, std::exception_ptr, completed, disposed>;
 
 public:
     using expected_disposable_strategy = rpp::details::observables::atomic_fixed_disposable_strategy_selector<1>;
 
+    subject_state() = default;
+
+    subject_state(const subject_state&) = delete;
+    subject_state(subject_state&&)      = delete;
+
+    ~subject_state() noexcept override
+    {
+        delete m_block.load(std::memory_order::acquire);
+    }
+
     template<rpp::constraint::observer_of_type<Type> TObs>
     void on_subscribe(TObs&& observer)
     {
         std::unique_lock lock{m_mutex};
-        process_state_unsafe(
-            m_state,
-            [&](const shared_observers& observers) {
-                auto new_observers       = make_copy_of_subscribed_observers(true, observers);
-                auto observer_as_dynamic = std::forward<TObs>(observer).as_dynamic();
-                new_observers->push_back(observer_as_dynamic);
-                m_state = std::move(new_observers);
-
-                lock.unlock();
-                set_upstream(observer_as_dynamic);
-            },
-            [&](const std::exception_ptr& err) {
-                lock.unlock();
-                observer.on_error(err);
-            },
-            [&](completed) {
-                lock.unlock();
-                observer.on_completed();
-            });
+        if (std::holds_alternative<std::monostate>(m_state))
+        {
+            auto observer_as_dynamic = std::forward<TObs>(observer).as_dynamic();
+
+            auto* block = m_block.load(std::memory_order::relaxed);
+            if (!block || block->is_full())
+                block = replace_block_unsafe(block, 1);
+            block->push_back(observer_as_dynamic);
+
+            const auto reclaimed = reclaim_unsafe();
+            lock.unlock();
+            reclaim_if_requested();
+
+            set_upstream(observer_as_dynamic);
+            return;
+        }
+
+        const auto state = m_state;
+        lock.unlock();
+        reclaim_if_requested();
+
+        std::visit(rpp::utils::overloaded{[&](const std::exception_ptr& err) { observer.on_error(err); },
+                                          [&](completed) { observer.on_completed(); },
+                                          rpp::utils::empty_function_any_t{}},
+                   state);
     }
 
     void on_next(const Type& v)
     {
-        if (const auto observers = extract_observers_under_lock_if_there())
-            rpp::utils::for_each(*observers, [&](const auto& sub) { sub.on_next(v); });
+        const auto epoch = enter();
+        if (const auto* block = m_block.load(std::memory_order::seq_cst))
+            block->for_each([&](const rpp::dynamic_observer<Type>& sub) { sub.on_next(v); });
+        leave(epoch);
     }
 
     void on_error(const std::exception_ptr& err)
     {
-        if (const auto observers = exchange_observers_under_lock_if_there(err))
-            rpp::utils::for_each(*observers, [&](const auto& sub) { sub.on_error(err); });
+        exchange_state(err, [&](const rpp::dynamic_observer<Type>& sub) { sub.on_error(err); });
     }
 
     void on_completed()
     {
-        if (const auto observers = exchange_observers_under_lock_if_there(completed{}))
-            rpp::utils::for_each(*observers, rpp::utils::static_mem_fn<&dynamic_observer<Type>::on_completed>{});
+        exchange_state(completed{}, rpp::utils::static_mem_fn<&dynamic_observer<Type>::on_completed>{});
     }
 
 private:
     void dispose_impl() noexcept override
     {
-        exchange_observers_under_lock_if_there(disposed{});
+        exchange_state(disposed{}, rpp::utils::empty_function_any_t{});
     }
 
     void set_upstream(rpp::dynamic_observer<Type>& obs)
@@ -99,68 +169,160 @@ private:
             [weak = this->weak_from_this()]() noexcept // NOLINT(bugprone-exception-escape)
             {
                 if (const auto shared = weak.lock())
-                {
-                    std::unique_lock lock{shared->m_mutex};
-                    process_state_unsafe(shared->m_state,
-                                         [&](const shared_observers& observers) {
-                                             shared->m_state = make_copy_of_subscribed_observers(false, observers);
-                                         });
-                }
+                    shared->on_observer_disposed();
             })});
     }
 
-    static shared_observers make_copy_of_subscribed_observers(bool add, const shared_observers& current_subs)
+    void on_observer_disposed()
+    {
+        std::unique_lock lock{m_mutex};
+        auto*            block = m_block.load(std::memory_order::relaxed);
+        if (!block)
+            return;
+
+        // compact block only when half of it is garbage to keep unsubscribe amortized O(1)
+        if (++m_disposed_count * 2 >= block->get_observers().size())
+            replace_block_unsafe(block, 0);
+
+        const auto reclaimed = reclaim_unsafe();
+        lock.unlock();
+        reclaim_if_requested();
+    }
+
+    /**
+     * @brief Moves subject to terminal state and passes observers subscribed till now to `fn`
+     */
+    template<typename Fn>
+    void exchange_state(state_t&& new_state, const Fn& fn)
     {
-        auto subs = std::make_shared<std::vector<dynamic_observer<Type>>>();
-        subs->reserve(deduce_new_size(add, current_subs));
-        if (current_subs)
+        std::unique_lock lock{m_mutex};
+        if (!std::holds_alternative<std::monostate>(m_state))
         {
-            std::copy_if(current_subs->cbegin(),
-                         current_subs->cend(),
-                         std::back_inserter(*subs),
-                         rpp::utils::static_not_mem_fn<&dynamic_observer<Type>::is_disposed>{});
+            lock.unlock();
+            reclaim_if_requested();
+            return;
         }
-        return subs;
+
+        m_state = std::move(new_state);
+        // registered before unpublishing, so, block retired below can't be reclaimed till end of delivering
+        const auto epoch = enter();
+        auto*      block = m_block.exchange(nullptr, std::memory_order::seq_cst);
+        retire_unsafe(block);
+        lock.unlock();
+        reclaim_if_requested();
+
+        if (block)
+            block->for_each(fn);
+        // reclaims retired block if nobody else uses it
+        leave(epoch);
     }
 
-    static size_t deduce_new_size(bool add, const shared_observers& current_subs)
+    observers_block* replace_block_unsafe(const observers_block* old, size_t extra)
     {
-        if (!current_subs)
-            return add ? 1 : 0;
+        const auto is_alive = [](const rpp::dynamic_observer<Type>& obs) { return !obs.is_disposed(); };
 
-        if (add)
-            return current_subs->size() + 1;
+        const size_t alive = old ? static_cast<size_t>(std::count_if(old->get_observers().cbegin(), old->get_observers().cend(), is_alive)) : 0;
+        auto         block = std::make_unique<observers_block>(std::max<size_t>((alive + extra) * 2, 4));
+        if (old)
+        {
+            for (const auto& observer : old->get_observers())
+            {
+                if (is_alive(observer))
+                    block->push_back(observer);
+            }
+        }
+        m_disposed_count = 0;
 
-        return std::max(current_subs->size(), size_t{1}) - 1;
+        auto* res = block.release();
+        retire_unsafe(m_block.exchange(res, std::memory_order::seq_cst));
+        return res;
     }
 
-    static void process_state_unsafe(const state_t& state, const auto&... actions)
+    void retire_unsafe(observers_block* block)
     {
-        std::visit(rpp::utils::overloaded{actions..., rpp::utils::empty_function_any_t{}}, state);
+        if (!block)
+            return;
+
+        // block is already unpublished: emitters registered from now on can't load it, move them to another counter to let current one drain
+        m_epoch.fetch_add(1, std::memory_order::seq_cst);
+        m_retired.push_back(retired_block{{}, std::unique_ptr<observers_block>{block}});
+        m_has_retired.store(true, std::memory_order::seq_cst);
     }
 
-    shared_observers extract_observers_under_lock_if_there()
+    /**
+     * @brief Extracts blocks which can't be used by any emitter anymore. Returned blocks should be destroyed outside of lock due to destruction of observers can lead to any user's code.
+     */
+    retired_blocks reclaim_unsafe()
     {
-        std::lock_guard lock{m_mutex};
+        retired_blocks res{};
+        std::erase_if(m_retired, [&](retired_block& retired) {
+            // emitter registered before retirement stays in its counter till end of iteration, so, empty counter means all of them are gone
+            for (size_t i = 0; i < m_readers.size(); ++i)
+                retired.drained[i] = retired.drained[i] || m_readers[i].load(std::memory_order::seq_cst) == 0;
 
-        if (!std::holds_alternative<shared_observers>(m_state))
-            return {};
+            if (!std::all_of(retired.drained.cbegin(), retired.drained.cend(), std::identity{}))
+                return false;
+            res.push_back(std::move(retired.block));
+            return true;
+        });
+        m_has_retired.store(!m_retired.empty(), std::memory_order::seq_cst);
+        return res;
+    }
 
-        return std::get<shared_observers>(m_state);
+    /**
+     * @brief Reclaims retired blocks if lock is free. Otherwise requests reclamation from current holder of lock: it checks request after unlocking.
+     */
+    void try_reclaim()
+    {
+        m_reclaim_requested.store(true, std::memory_order::seq_cst);
+        while (m_reclaim_requested.load(std::memory_order::seq_cst))
+        {
+            std::unique_lock lock{m_mutex, std::try_to_lock};
+            if (!lock.owns_lock())
+                return;
+
+            m_reclaim_requested.store(false, std::memory_order::seq_cst);
+            const auto reclaimed = reclaim_unsafe();
+            lock.unlock();
+        }
     }
 
-    shared_observers exchange_observers_under_lock_if_there(state_t&& new_val)
+    void reclaim_if_requested()
     {
-        std::lock_guard lock{m_mutex};
+        if (m_reclaim_requested.load(std::memory_order::seq_cst))
+            try_reclaim();
+    }
 
-        if (!std::holds_alternative<shared_observers>(m_state))
-            return {};
+    size_t enter()
+    {
+        while (true)
+        {
+            const auto epoch = m_epoch.load(std::memory_order::seq_cst);
+            m_readers[epoch % m_readers.size()].fetch_add(1, std::memory_order::seq_cst);
+            // epoch could be advanced (and block replaced) between reading of epoch and registration
+            if (m_epoch.load(std::memory_order::seq_cst) == epoch)
+                return epoch;
+            leave(epoch);
+        }
+    }
 
-        return std::get<shared_observers>(std::exchange(m_state, std::move(new_val)));
+    void leave(size_t epoch)
+    {
+        // last emitter of counter is the one who could keep retired blocks alive
+        if (m_readers[epoch % m_readers.size()].fetch_sub(1, std::memory_order::seq_cst) == 1 && m_has_retired.load(std::memory_order::seq_cst))
+            try_reclaim();
     }
 
 private:
-    state_t    m_state{};
-    std::mutex m_mutex{};
+    std::atomic<observers_block*>      m_block{};
+    std::atomic<size_t>                m_epoch{};
+    std::array<std::atomic<size_t>, 2> m_readers{};
+    std::atomic_bool                   m_has_retired{};
+    std::atomic_bool                   m_reclaim_requested{};
+
+    std::mutex                 m_mutex{};
+    state_t                    m_state{};
+    size_t                     m_disposed_count{};
+    std::vector<retired_block> m_retired{};
 };
-} // namespace rpp::subjects::details
\ No newline at end of file
+} // namespace rpp::subjects::details
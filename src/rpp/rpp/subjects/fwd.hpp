@@ -30,7 +30,25 @@ template<rpp::constraint::decayed_type T, constraint::subject_strategy<T> Strate
 class base_subject;
 
 template<rpp::constraint::decayed_type Type>
+class subject_state;
+
+template<rpp::constraint::decayed_type Type>
+class single_threaded_subject_state;
+
+template<rpp::constraint::decayed_type Type, typename State>
 class publish_strategy;
+
+template<rpp::constraint::decayed_type Type>
+class serialized_strategy;
+
+template<rpp::constraint::decayed_type Type>
+class behavior_strategy;
+
+template<rpp::constraint::decayed_type Type>
+class replay_strategy;
+
+template<rpp::constraint::decayed_type Type>
+class async_strategy;
 }
 
 namespace rpp::subjects
@@ -48,7 +66,81 @@ namespace rpp::subjects
  * @see https://reactivex.io/documentation/subject.html
  */
 template<rpp::constraint::decayed_type Type>
-using publish_subject = details::base_subject<Type, details::publish_strategy<Type>>;
+using publish_subject = details::base_subject<Type, details::publish_strategy<Type, details::subject_state<Type>>>;
+
+/**
+ * @brief Same as rpp::subjects::publish_subject, but all callbacks of its observer are serialized via mutex, so, it can be used from multiple threads simultaneously without any extra synchronization on caller side.
+ *
+ * @details Mutex is recursive, so, observers can emit new values into the same subject from inside of their callbacks.
+ *
+ * @tparam Type value provided by this subject
+ *
+ * @ingroup subjects
+ * @see https://reactivex.io/documentation/subject.html
+ */
+template<rpp::constraint::decayed_type Type>
+using serialized_subject = details::base_subject<Type, details::serialized_strategy<Type>>;
+
+/**
+ * @brief Same as rpp::subjects::publish_subject, but expected to be used (emitting, subscribing and disposing) only from one thread. In exchange it doesn't use any locks and atomics during emissions.
+ *
+ * @warning any usage of this subject from multiple threads (even with external serialization of emissions) leads to data race. Use rpp::subjects::publish_subject or rpp::subjects::serialized_subject instead.
+ *
+ * @tparam Type value provided by this subject
+ *
+ * @ingroup subjects
+ * @see https://reactivex.io/documentation/subject.html
+ */
+template<rpp::constraint::decayed_type Type>
+using single_threaded_subject = details::base_subject<Type, details::publish_strategy<Type, details::single_threaded_subject_state<Type>>>;
+
+/**
+ * @brief Same as rpp::subjects::publish_subject, but keeps latest emitted value (or initial one provided to constructor) and emits it to each new observer before any other values.
+ *
+ * @details After on_error/on_completed new observers obtain only cached error/completion.
+ * @details Mutex guards only latest value and observers are never called under it. New observer is registered before reading of latest value and emissions happened during delivering of it are queued, so, observer subscribed concurrently with emission obtains either new value or old one followed by new one.
+ *
+ * @warning same as rpp::subjects::publish_subject this subject is not synchronized/serialized!
+ *
+ * @tparam Type value provided by this subject
+ *
+ * @ingroup subjects
+ * @see https://reactivex.io/documentation/subject.html
+ */
+template<rpp::constraint::decayed_type Type>
+using behavior_subject = details::base_subject<Type, details::behavior_strategy<Type>>;
+
+/**
+ * @brief Same as rpp::subjects::publish_subject, but keeps history of emitted values and emits it to each new observer before any other values.
+ *
+ * @details History can be bounded by amount of values and/or by age of values (values older than `duration` are dropped), for example `replay_subject<int>{10, std::chrono::seconds{1}}`. History is kept in fixed-size chunks and exhausted chunk is reused for new values, so, emissions don't allocate after it reaches its bound (unless chunk is still replayed to some observer). New observer replays history right from these chunks without copying of it. New observer obtains history and then cached error/completion (if any).
+ * @details Mutex guards only history and observers are never called under it. New observer is registered before taking snapshot of history and emissions happened during replaying are queued (and skipped if already replayed), so, there is no gap or duplicate between replayed values and live ones.
+ *
+ * @warning same as rpp::subjects::publish_subject this subject is not synchronized/serialized!
+ *
+ * @tparam Type value provided by this subject
+ *
+ * @ingroup subjects
+ * @see https://reactivex.io/documentation/subject.html
+ */
+template<rpp::constraint::decayed_type Type>
+using replay_subject = details::base_subject<Type, details::replay_strategy<Type>>;
+
+/**
+ * @brief Subject which emits only last value (if any) and only after on_completed. Both current and future observers obtain this value and completion.
+ *
+ * @details In case of on_error observers obtain only error.
+ * @details Mutex guards only last value and observers are never called under it. New observer is registered before reading of last value and completion happened during subscription is skipped if value is already replayed, so, each observer obtains last value exactly once.
+ *
+ * @warning same as rpp::subjects::publish_subject this subject is not synchronized/serialized!
+ *
+ * @tparam Type value provided by this subject
+ *
+ * @ingroup subjects
+ * @see https://reactivex.io/documentation/subject.html
+ */
+template<rpp::constraint::decayed_type Type>
+using async_subject = details::base_subject<Type, details::async_strategy<Type>>;
 }
 
 namespace rpp::subjects::utils
@@ -13,18 +13,19 @@
 
 #include <rpp/observers/observer.hpp>
 #include <rpp/subjects/details/base_subject.hpp>
+#include <rpp/subjects/details/single_threaded_subject_state.hpp>
 #include <rpp/subjects/details/subject_state.hpp>
 
 #include <memory>
 
 namespace rpp::subjects::details
 {
-template<rpp::constraint::decayed_type Type>
+template<rpp::constraint::decayed_type Type, typename State>
 class publish_strategy
 {
     struct observer_strategy
     {
-        std::shared_ptr<subject_state<Type>> state{};
+        std::shared_ptr<State> state{};
 
         void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
@@ -39,7 +40,7 @@ class publish_strategy
 
 public:
 
-    using expected_disposable_strategy = rpp::details::observables::deduce_disposable_strategy_t<subject_state<Type>>;
+    using expected_disposable_strategy = rpp::details::observables::deduce_disposable_strategy_t<State>;
 
     auto get_observer() const
     {
@@ -58,6 +59,6 @@ public:
     }
 
 private:
-    std::shared_ptr<subject_state<Type>> m_state = std::make_shared<subject_state<Type>>();
+    std::shared_ptr<State> m_state = std::make_shared<State>();
 };
 } // namespace rpp::subjects::details
\ No newline at end of file
@@ -0,0 +1,325 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/subjects/fwd.hpp>
+
+#include <rpp/observers/observer.hpp>
+#include <rpp/schedulers/clocks.hpp>
+#include <rpp/subjects/details/base_subject.hpp>
+#include <rpp/subjects/details/replaying_observer.hpp>
+#include <rpp/subjects/details/subject_state.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace rpp::subjects::details
+{
+template<rpp::constraint::decayed_type Type>
+class replay_strategy
+{
+    struct replay_value
+    {
+        Type                        value;
+        rpp::schedulers::time_point timepoint;
+    };
+
+    /**
+     * @brief Fixed-size part of history. Values are only appended into it and never modified after that, so, readers can iterate over published part without lock.
+     *
+     * @details References to chunks are acquired and released only under lock of history, so, `use_count` is exact under this lock. Chain of chunks is always destroyed iteratively to avoid stack overflow.
+     */
+    struct chunk
+    {
+        explicit chunk(size_t capacity)
+            : capacity{capacity}
+        {
+            values.reserve(capacity);
+            data = values.data();
+        }
+
+        chunk(const chunk&) = delete;
+        chunk(chunk&&)      = delete;
+
+        bool is_full() const { return values.size() == capacity; }
+
+        const size_t              capacity;
+        // only for writers under lock
+        std::vector<replay_value> values{};
+        // capacity is reserved, so, published values are never relocated
+        const replay_value*       data{};
+        std::shared_ptr<chunk>    next{};
+    };
+
+    /**
+     * @brief Part of history published at the moment of subscription. It keeps its chunks alive, so, it can be replayed without lock and copying even if history is modified in parallel.
+     */
+    class snapshot
+    {
+    public:
+        snapshot() = default;
+
+        snapshot(std::mutex& mutex, std::shared_ptr<chunk> first, size_t offset, size_t size)
+            : m_mutex{&mutex}
+            , m_first{std::move(first)}
+            , m_offset{offset}
+            , m_size{size}
+        {
+        }
+
+        snapshot(const snapshot&) = delete;
+
+        snapshot(snapshot&& other) noexcept
+            : m_mutex{other.m_mutex}
+            , m_first{std::move(other.m_first)}
+            , m_offset{other.m_offset}
+            , m_size{other.m_size}
+        {
+        }
+
+        /**
+         * @brief Releases chunks under lock of history (it is the one making chunks reusable) and destroys ones nobody else refers to outside of it.
+         *
+         * @warning snapshot has to be destroyed outside of lock of history.
+         */
+        ~snapshot() noexcept
+        {
+            if (!m_first)
+                return;
+
+            std::unique_lock lock{*m_mutex};
+            if (m_first.use_count() != 1)
+            {
+                m_first.reset();
+                return;
+            }
+
+            chunk* last = m_first.get();
+            while (last->next && last->next.use_count() == 1)
+                last = last->next.get();
+            last->next.reset();
+            lock.unlock();
+
+            while (m_first)
+                m_first = std::move(m_first->next);
+        }
+
+        template<typename Fn>
+        void for_each(const Fn& fn) const
+        {
+            const chunk* current = m_first.get();
+            size_t       index   = m_offset;
+            for (size_t i = 0; i < m_size; ++i)
+            {
+                if (index == current->capacity)
+                {
+                    current = current->next.get();
+                    index   = 0;
+                }
+                fn(current->data[index++].value);
+            }
+        }
+
+    private:
+        std::mutex*            m_mutex{};
+        std::shared_ptr<chunk> m_first{};
+        size_t                 m_offset{};
+        size_t                 m_size{};
+    };
+
+    class values_state
+    {
+        static constexpr size_t s_max_chunk_capacity = 64;
+
+    public:
+        values_state(size_t count, rpp::schedulers::duration duration)
+            : m_count{count}
+            , m_duration{duration}
+        {
+        }
+
+        values_state(const values_state&) = delete;
+        values_state(values_state&&)      = delete;
+
+        ~values_state() noexcept
+        {
+            while (m_head)
+                m_head = std::move(m_head->next);
+        }
+
+        std::mutex& get_mutex() { return m_mutex; }
+
+        const std::atomic<size_t>& get_sequence() const { return m_sequence; }
+
+        void add_unsafe(const Type& v)
+        {
+            m_sequence.fetch_add(1, std::memory_order::release);
+            if (m_count == 0 || m_is_terminated)
+                return;
+
+            const auto now = rpp::schedulers::default_clock::now();
+            if (m_size == m_count)
+                pop_front_unsafe();
+            if (!m_tail || m_tail->is_full())
+                append_chunk_unsafe();
+            m_tail->values.push_back(replay_value{v, now});
+            ++m_size;
+            evict_expired_unsafe(now);
+        }
+
+        void terminate_unsafe()
+        {
+            m_is_terminated = true;
+        }
+
+        std::pair<snapshot, size_t> get_snapshot_unsafe(const subject_state<Type>& state)
+        {
+            // terminated subject is disposed too, but its history still should be replayed
+            if (!m_is_terminated && state.is_disposed())
+                return {snapshot{}, m_sequence.load(std::memory_order::relaxed)};
+
+            evict_expired_unsafe(rpp::schedulers::default_clock::now());
+            return {snapshot{m_mutex, m_head, m_offset, m_size}, m_sequence.load(std::memory_order::relaxed)};
+        }
+
+    private:
+        void evict_expired_unsafe(rpp::schedulers::time_point now)
+        {
+            if (m_duration == rpp::schedulers::duration::max())
+                return;
+
+            while (m_size != 0 && now - m_head->data[m_offset].timepoint > m_duration)
+                pop_front_unsafe();
+        }
+
+        /**
+         * @brief Evicts value logically. Value itself is destroyed only when its chunk is exhausted and released by all snapshots, so, history keeps at most one extra chunk.
+         */
+        void pop_front_unsafe()
+        {
+            --m_size;
+            if (++m_offset != m_head->capacity && m_size != 0)
+                return;
+
+            auto exhausted = std::exchange(m_head, m_head->next);
+            m_offset       = 0;
+            if (!m_head)
+                m_tail = nullptr;
+
+            // chunk nobody else refers to (no snapshots) is reused, so, emissions don't allocate after history reaches its bound
+            if (exhausted.use_count() == 1)
+            {
+                exhausted->values.clear();
+                exhausted->next.reset();
+                m_spare = std::move(exhausted);
+            }
+        }
+
+        void append_chunk_unsafe()
+        {
+            auto new_chunk = m_spare ? std::move(m_spare) : std::make_shared<chunk>(std::min(m_count, s_max_chunk_capacity));
+            if (m_tail)
+                m_tail->next = new_chunk;
+            else
+                m_head = new_chunk;
+            m_tail = new_chunk.get();
+        }
+
+    private:
+        const size_t                    m_count;
+        const rpp::schedulers::duration m_duration;
+        // guards only history: observers are never called under it
+        std::mutex                      m_mutex{};
+        std::shared_ptr<chunk>          m_head{};
+        chunk*                          m_tail{};
+        // index of first value inside of head chunk
+        size_t                          m_offset{};
+        size_t                          m_size{};
+        std::shared_ptr<chunk>          m_spare{};
+        bool                            m_is_terminated{};
+        std::atomic<size_t>             m_sequence{};
+    };
+
+    struct observer_strategy
+    {
+        std::shared_ptr<subject_state<Type>> state{};
+        std::shared_ptr<values_state>        values{};
+
+        void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
+
+        bool is_disposed() const noexcept { return state->is_disposed(); }
+
+        void on_next(const Type& v) const
+        {
+            if (state->is_disposed())
+                return;
+
+            {
+                std::lock_guard lock{values->get_mutex()};
+                values->add_unsafe(v);
+            }
+            state->on_next(v);
+        }
+
+        void on_error(const std::exception_ptr& err) const
+        {
+            {
+                std::lock_guard lock{values->get_mutex()};
+                values->terminate_unsafe();
+            }
+            state->on_error(err);
+        }
+
+        void on_completed() const
+        {
+            {
+                std::lock_guard lock{values->get_mutex()};
+                values->terminate_unsafe();
+            }
+            state->on_completed();
+        }
+    };
+
+public:
+    using expected_disposable_strategy = rpp::details::observables::deduce_disposable_strategy_t<subject_state<Type>>;
+
+    explicit replay_strategy(size_t count = std::numeric_limits<size_t>::max(), rpp::schedulers::duration duration = rpp::schedulers::duration::max())
+        : m_values{std::make_shared<values_state>(count, duration)}
+    {
+    }
+
+    auto get_observer() const
+    {
+        return rpp::observer<Type, rpp::details::with_external_disposable<observer_strategy>>{composite_disposable_wrapper{m_state}, observer_strategy{m_state, m_values}};
+    }
+
+    template<rpp::constraint::observer_of_type<Type> TObs>
+    void on_subscribe(TObs&& observer) const
+    {
+        subscribe_with_replay(*m_state, m_values->get_mutex(), std::shared_ptr<const std::atomic<size_t>>{m_values, &m_values->get_sequence()}, std::forward<TObs>(observer), [&] {
+            return m_values->get_snapshot_unsafe(*m_state);
+        });
+    }
+
+    rpp::disposable_wrapper get_disposable() const
+    {
+        return rpp::disposable_wrapper{m_state};
+    }
+
+private:
+    std::shared_ptr<subject_state<Type>> m_state = std::make_shared<subject_state<Type>>();
+    std::shared_ptr<values_state>        m_values;
+};
+} // namespace rpp::subjects::details
@@ -23,4 +23,9 @@ struct more_disposables_than_expected : public std::runtime_error
 {
     using std::runtime_error::runtime_error;
 };
+
+struct queue_overflow : public std::runtime_error
+{
+    using std::runtime_error::runtime_error;
+};
 }
\ No newline at end of file
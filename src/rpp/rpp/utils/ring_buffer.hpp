@@ -0,0 +1,189 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/utils/constraints.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace rpp::utils
+{
+/**
+ * @brief FIFO container keeping values in one contiguous circular buffer.
+ *
+ * @details Pushing to back and popping from front are O(1) and don't allocate while size is below capacity. Buffer grows (2x) only when it is full, so, steady-state usage (for example, bounded history or queue with stable size) doesn't touch allocator at all.
+ */
+template<rpp::constraint::decayed_type T>
+class ring_buffer
+{
+public:
+    ring_buffer() = default;
+
+    explicit ring_buffer(size_t capacity)
+    {
+        reserve(capacity);
+    }
+
+    ring_buffer(const ring_buffer& other)
+    {
+        reserve(other.size());
+        try
+        {
+            for (size_t i = 0; i < other.size(); ++i)
+                push_back(other[i]);
+        }
+        catch (...)
+        {
+            // destructor is not called for partially constructed object
+            clear();
+            deallocate(m_data);
+            throw;
+        }
+    }
+
+    ring_buffer(ring_buffer&& other) noexcept
+        : m_data{std::exchange(other.m_data, nullptr)}
+        , m_capacity{std::exchange(other.m_capacity, 0)}
+        , m_head{std::exchange(other.m_head, 0)}
+        , m_size{std::exchange(other.m_size, 0)}
+    {
+    }
+
+    ring_buffer& operator=(ring_buffer other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~ring_buffer() noexcept
+    {
+        clear();
+        deallocate(m_data);
+    }
+
+    void swap(ring_buffer& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_head, other.m_head);
+        std::swap(m_size, other.m_size);
+    }
+
+    bool   empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+    size_t capacity() const { return m_capacity; }
+
+    T&       operator[](size_t index) { return m_data[physical_index(index)]; }
+    const T& operator[](size_t index) const { return m_data[physical_index(index)]; }
+
+    T&       front() { return m_data[m_head]; }
+    const T& front() const { return m_data[m_head]; }
+
+    T&       back() { return (*this)[m_size - 1]; }
+    const T& back() const { return (*this)[m_size - 1]; }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (m_size == m_capacity)
+            reserve(std::max<size_t>(4, m_capacity * 2));
+
+        auto* ptr = std::construct_at(m_data + physical_index(m_size), std::forward<Args>(args)...);
+        ++m_size;
+        return *ptr;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_front()
+    {
+        std::destroy_at(m_data + m_head);
+        m_head = m_head + 1 == m_capacity ? 0 : m_head + 1;
+        --m_size;
+    }
+
+    void clear()
+    {
+        while (!empty())
+            pop_front();
+        m_head = 0;
+    }
+
+    /**
+     * @brief Makes capacity at least `capacity`. Values are moved into linear order of new buffer.
+     * @details Strong exception guarantee: values are copied instead of moving if move constructor can throw, and original buffer is touched only once all values are constructed in new one.
+     */
+    void reserve(size_t capacity)
+    {
+        if (capacity <= m_capacity)
+            return;
+
+        auto*  data = allocate(capacity);
+        size_t constructed{};
+        try
+        {
+            for (; constructed < m_size; ++constructed)
+                std::construct_at(data + constructed, std::move_if_noexcept((*this)[constructed]));
+        }
+        catch (...)
+        {
+            std::destroy(data, data + constructed);
+            deallocate(data);
+            throw;
+        }
+
+        for (size_t i = 0; i < m_size; ++i)
+            std::destroy_at(&(*this)[i]);
+        deallocate(m_data);
+        m_data     = data;
+        m_capacity = capacity;
+        m_head     = 0;
+    }
+
+    template<typename Fn>
+    void for_each(Fn&& fn) const
+    {
+        // at most two contiguous parts: from head till end of buffer and from beginning of buffer
+        const size_t first_part = std::min(m_size, m_capacity - m_head);
+        std::for_each(m_data + m_head, m_data + m_head + first_part, fn);
+        std::for_each(m_data, m_data + (m_size - first_part), fn);
+    }
+
+private:
+    size_t physical_index(size_t index) const
+    {
+        const auto res = m_head + index;
+        return res >= m_capacity ? res - m_capacity : res;
+    }
+
+    static T* allocate(size_t capacity)
+    {
+        return static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+
+    static void deallocate(T* data) noexcept
+    {
+        if (data)
+            ::operator delete(data, std::align_val_t{alignof(T)});
+    }
+
+private:
+    T*     m_data{};
+    size_t m_capacity{};
+    size_t m_head{};
+    size_t m_size{};
+};
+} // namespace rpp::utils
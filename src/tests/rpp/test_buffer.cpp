@@ -11,6 +11,7 @@
 #include <snitch/snitch.hpp>
 
 #include <rpp/sources/just.hpp>
+#include <rpp/schedulers/immediate.hpp>
 #include <rpp/sources/error.hpp>
 #include <rpp/operators/buffer.hpp>
 #include <rpp/operators/merge.hpp>
@@ -96,6 +97,27 @@ TEST_CASE("buffer bundles items")
         }
     }
 
+    SECTION("observable of -1-2-3-4-5-|")
+    {
+        auto mock = mock_observer_strategy<std::vector<int>>{};
+        auto obs = rpp::source::just(1,2,3,4,5);
+        SECTION("subscribe on it via buffer(2)")
+        {
+            obs | rpp::ops::buffer(2)
+                | rpp::ops::subscribe(mock);
+            SECTION("shall see -{1,2}-{3,4}-{5}|, each bucket is full")
+            {
+                CHECK(mock.get_received_values() == std::vector<std::vector<int>>{
+                    std::vector{1,2},
+                    std::vector{3,4},
+                    std::vector{5},
+                });
+                CHECK(mock.get_on_completed_count() == 1);
+                CHECK(mock.get_on_error_count() == 0);
+            }
+        }
+    }
+
     SECTION("observable of -1-x-2-|, which error is raised in the middle")
     {
         auto obs = rpp::source::just(rpp::source::just(1).as_dynamic(),
@@ -146,4 +168,19 @@ TEST_CASE("buffer bundles items")
 TEST_CASE("buffer satisfies disposable contracts")
 {
     test_operator_with_disposable<int>(rpp::ops::buffer(1));
-}
\ No newline at end of file
+}
+
+TEST_CASE("buffer translates demand in buckets to demand in items")
+{
+    auto observer = requesting_mock_observer_strategy<std::vector<int>>{1};
+    rpp::source::from_iterable_on_demand(std::vector{1, 2, 3, 4, 5}, rpp::schedulers::immediate{})
+        | rpp::ops::buffer(2)
+        | rpp::ops::subscribe(observer.get_observer());
+
+    CHECK(observer.is_backpressured());
+    CHECK(observer.get_mock().get_received_values() == std::vector<std::vector<int>>{{1, 2}});
+
+    observer.request(2);
+    CHECK(observer.get_mock().get_received_values() == std::vector<std::vector<int>>{{1, 2}, {3, 4}, {5}});
+    CHECK(observer.get_mock().get_on_completed_count() == 1);
+}
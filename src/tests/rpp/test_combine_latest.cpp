@@ -26,6 +26,10 @@
 #include "disposable_observable.hpp"
 #include "snitch_logging.hpp"
 
+#include <atomic>
+#include <thread>
+#include <tuple>
+
 TEST_CASE("combine_latest bundles items")
 {
     SECTION("observable of -1-2-3-| combines with -4-5-6-| on immediate scheduler")
@@ -158,6 +162,40 @@ TEST_CASE("combine_latest handles race condition")
     }
 }
 
+TEST_CASE("combine_latest serializes emissions from many threads")
+{
+    constexpr int values_count = 1000;
+
+    auto             subj_1 = rpp::subjects::publish_subject<int>{};
+    auto             subj_2 = rpp::subjects::publish_subject<int>{};
+    std::atomic_bool is_emitting{};
+    std::atomic_bool was_overlap{};
+    size_t           count{};
+
+    subj_1.get_observable()
+        | rpp::ops::combine_latest(subj_2.get_observable())
+        | rpp::ops::subscribe([&](const std::tuple<int, int>&) {
+              if (is_emitting.exchange(true))
+                  was_overlap = true;
+              ++count;
+              is_emitting = false;
+          });
+
+    subj_1.get_observer().on_next(0);
+    subj_2.get_observer().on_next(0);
+
+    std::thread t{[&] {
+        for (int v = 0; v < values_count; ++v)
+            subj_1.get_observer().on_next(v);
+    }};
+    for (int v = 0; v < values_count; ++v)
+        subj_2.get_observer().on_next(v);
+    t.join();
+
+    CHECK(!was_overlap);
+    CHECK(count == 1 + 2 * values_count);
+}
+
 TEST_CASE("combine_latest satisfies disposable contracts")
 {
     auto observable_disposable = std::make_shared<rpp::composite_disposable>();
@@ -0,0 +1,131 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+#include <snitch/snitch_macros_check.hpp>
+
+#include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/concat_map.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/sources/error.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/sources/never.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "mock_observer.hpp"
+#include "disposable_observable.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEMPLATE_TEST_CASE("concat_map", "", rpp::memory_model::use_stack, rpp::memory_model::use_shared)
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SECTION("observable of items")
+    {
+        auto obs = rpp::source::just<TestType>(rpp::schedulers::immediate{}, 1, 2, 3);
+
+        SECTION("subscribe using concat_map")
+        {
+            obs | rpp::ops::concat_map([](int v) { return rpp::source::just(v, v * 10); })
+                | rpp::ops::subscribe(mock);
+            SECTION("observer obtains values from underlying observables in order")
+            {
+                CHECK(mock.get_received_values() == std::vector{1, 10, 2, 20, 3, 30});
+                CHECK(mock.get_on_completed_count() == 1);
+            }
+        }
+        SECTION("subscribe using concat_map with never in middle")
+        {
+            obs | rpp::ops::concat_map([](int v) {
+                    if (v == 2)
+                        return rpp::source::never<int>().as_dynamic();
+                    return rpp::source::just(v).as_dynamic();
+                  })
+                | rpp::ops::subscribe(mock);
+            SECTION("observer doesn't obtain values after never")
+            {
+                CHECK(mock.get_received_values() == std::vector{1});
+                CHECK(mock.get_on_completed_count() == 0);
+            }
+        }
+        SECTION("subscribe using concat_map with error in middle")
+        {
+            obs | rpp::ops::concat_map([](int v) {
+                    if (v == 2)
+                        return rpp::source::error<int>(std::make_exception_ptr(std::runtime_error{""})).as_dynamic();
+                    return rpp::source::just(v).as_dynamic();
+                  })
+                | rpp::ops::subscribe(mock);
+            SECTION("observer obtains error and no values after it")
+            {
+                CHECK(mock.get_received_values() == std::vector{1});
+                CHECK(mock.get_on_error_count() == 1);
+                CHECK(mock.get_on_completed_count() == 0);
+            }
+        }
+    }
+}
+
+TEST_CASE("concat_map subscribes next observable only after completion of previous one")
+{
+    auto                                             mock = mock_observer_strategy<int>();
+    rpp::subjects::publish_subject<int>              source{};
+    std::vector<rpp::subjects::publish_subject<int>> inners(2);
+
+    source.get_observable()
+        | rpp::ops::concat_map([&](int i) { return inners[static_cast<size_t>(i)].get_observable(); })
+        | rpp::ops::subscribe(mock);
+
+    source.get_observer().on_next(0);
+    source.get_observer().on_next(1);
+    source.get_observer().on_completed();
+
+    inners[1].get_observer().on_next(1);
+    inners[0].get_observer().on_next(0);
+    CHECK(mock.get_received_values() == std::vector{0});
+
+    inners[0].get_observer().on_completed();
+    inners[1].get_observer().on_next(1);
+    CHECK(mock.get_received_values() == std::vector{0, 1});
+    CHECK(mock.get_on_completed_count() == 0);
+
+    inners[1].get_observer().on_completed();
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
+TEST_CASE("concat_map keeps order with observables completing in other threads")
+{
+    constexpr int    count = 100;
+    std::vector<int> values{};
+    std::atomic_bool is_emitting{};
+    std::atomic_bool was_overlap{};
+
+    rpp::source::just(rpp::schedulers::immediate{}, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9)
+        | rpp::ops::concat_map([](int v) { return rpp::source::just(rpp::schedulers::new_thread{}, v * count, v * count + 1); })
+        | rpp::ops::as_blocking()
+        | rpp::ops::subscribe([&](int v) {
+              if (is_emitting.exchange(true))
+                  was_overlap = true;
+              values.push_back(v);
+              is_emitting = false;
+          });
+
+    CHECK(!was_overlap);
+    CHECK(values == std::vector{0, 1, 100, 101, 200, 201, 300, 301, 400, 401, 500, 501, 600, 601, 700, 701, 800, 801, 900, 901});
+}
+
+TEST_CASE("concat_map satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::concat_map([](const auto& v) { return rpp::source::just(v); }));
+}
@@ -13,17 +13,27 @@
 #include <rpp/sources/just.hpp>
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/empty.hpp>
+#include <rpp/sources/create.hpp>
 #include <rpp/subjects/publish_subject.hpp>
 
 #include <rpp/operators/delay.hpp>
+#include <rpp/operators/map.hpp>
 #include <rpp/operators/observe_on.hpp>
 #include <rpp/operators/as_blocking.hpp>
 
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/schedulers/run_loop.hpp>
+
 #include "snitch_logging.hpp"
 #include "mock_observer.hpp"
 #include "disposable_observable.hpp"
 #include "test_scheduler.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <numeric>
+
 namespace
 {
 
@@ -296,4 +306,175 @@ TEST_CASE("observe_on forward error immediately")
         CHECK(scheduler.get_schedulings() == std::vector{now+delay_duration});
         CHECK(scheduler.get_executions() == std::vector<rpp::schedulers::time_point>{});
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("observe_on doesn't emit error concurrently with items being emitted")
+{
+    auto mock      = mock_observer_strategy<int>{};
+    auto scheduler = test_scheduler{};
+    auto subject   = rpp::subjects::publish_subject<int>{};
+
+    size_t on_error_count_during_on_next{};
+    subject.get_observable()
+        | rpp::ops::observe_on(scheduler, std::chrono::seconds{1})
+        | rpp::ops::subscribe([&](int v) {
+                                  mock.on_next(v);
+                                  // error arrives while 1 is being emitted and 2 is already taken by draining thread
+                                  auto f = std::async(std::launch::async, [&] { subject.get_observer().on_error({}); });
+                                  f.wait_for(std::chrono::milliseconds{100});
+                                  on_error_count_during_on_next = mock.get_on_error_count();
+                                  f.wait();
+                              },
+                              [&](const std::exception_ptr& err) { mock.on_error(err); });
+
+    subject.get_observer().on_next(1);
+    subject.get_observer().on_next(2);
+    scheduler.time_advance(std::chrono::seconds{1});
+
+    CHECK(on_error_count_during_on_next == 0);
+    CHECK(mock.get_received_values() == std::vector{1});
+    CHECK(mock.get_on_error_count() == 1);
+}
+
+TEST_CASE("delay limits amount of queued items of backpressured observable")
+{
+    auto   scheduler = test_scheduler{};
+    auto   mock      = mock_observer_strategy<size_t>{};
+    size_t produced{};
+
+    rpp::source::from_iterable_on_demand(std::vector<size_t>(1000), rpp::schedulers::immediate{})
+        | rpp::ops::map([&](size_t) { return produced++; })
+        | rpp::ops::delay(std::chrono::seconds{1}, scheduler)
+        | rpp::ops::subscribe(mock);
+
+    CHECK(produced == rpp::operators::details::backpressure_prefetch);
+    CHECK(mock.get_total_on_next_count() == 0);
+
+    scheduler.time_advance(std::chrono::seconds{1});
+
+    CHECK(mock.get_total_on_next_count() == rpp::operators::details::backpressure_prefetch);
+    CHECK(produced - mock.get_total_on_next_count() <= rpp::operators::details::backpressure_prefetch);
+
+    for (size_t i = 0; i < 20; ++i)
+        scheduler.time_advance(std::chrono::seconds{1});
+
+    CHECK(mock.get_total_on_next_count() == 1000);
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
+TEST_CASE("observe_on with bounded queue applies overflow policy")
+{
+    auto run_loop = rpp::schedulers::run_loop{};
+    auto mock     = mock_observer_strategy<int>{};
+    auto subj     = rpp::subjects::publish_subject<int>{};
+
+    const auto emit_and_dispatch = [&](const auto& op) {
+        subj.get_observable() | op | rpp::ops::subscribe(mock);
+        for (int v : {1, 2, 3, 4, 5})
+            subj.get_observer().on_next(v);
+        subj.get_observer().on_completed();
+
+        while (!run_loop.is_empty())
+            run_loop.dispatch();
+    };
+
+    SECTION("drop_newest keeps first items")
+    {
+        const auto op = rpp::ops::observe_on(run_loop, 2, rpp::ops::overflow_policy::drop_newest);
+        emit_and_dispatch(op);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(op.get_dropped_count() == 3);
+    }
+    SECTION("drop_oldest keeps last items")
+    {
+        const auto op = rpp::ops::observe_on(run_loop, 2, rpp::ops::overflow_policy::drop_oldest);
+        emit_and_dispatch(op);
+
+        CHECK(mock.get_received_values() == std::vector{4, 5});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(op.get_dropped_count() == 3);
+    }
+    SECTION("error drops queued items and emits error")
+    {
+        const auto op = rpp::ops::observe_on(run_loop, 2, rpp::ops::overflow_policy::error);
+        emit_and_dispatch(op);
+
+        CHECK(mock.get_received_values() == std::vector<int>{});
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(mock.get_on_completed_count() == 0);
+        // overflowing item and both queued ones
+        CHECK(op.get_dropped_count() == 3);
+    }
+    SECTION("queue is not overflowed by consumed items")
+    {
+        const auto op = rpp::ops::observe_on(run_loop, 2, rpp::ops::overflow_policy::error);
+        subj.get_observable() | op | rpp::ops::subscribe(mock);
+        for (int v : {1, 2, 3, 4, 5})
+        {
+            subj.get_observer().on_next(v);
+            run_loop.dispatch();
+        }
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 5});
+        CHECK(mock.get_on_error_count() == 0);
+        CHECK(op.get_dropped_count() == 0);
+    }
+    SECTION("backpressured observable never overflows queue")
+    {
+        const auto op = rpp::ops::observe_on(run_loop, 4, rpp::ops::overflow_policy::error);
+        rpp::source::from_iterable_on_demand(std::vector<int>(100, 1), rpp::schedulers::immediate{}) | op | rpp::ops::subscribe(mock);
+
+        while (!run_loop.is_empty())
+            run_loop.dispatch();
+
+        CHECK(mock.get_total_on_next_count() == 100);
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(op.get_dropped_count() == 0);
+    }
+}
+
+TEST_CASE("observe_on with bounded queue blocks producer")
+{
+    std::vector<int> values{};
+    std::atomic_bool is_completed{};
+
+    rpp::source::create<int>([](const auto& obs) {
+        for (int v = 0; v < 100; ++v)
+            obs.on_next(v);
+        obs.on_completed();
+    })
+        | rpp::ops::observe_on(rpp::schedulers::new_thread{}, 1, rpp::ops::overflow_policy::block_producer)
+        | rpp::ops::as_blocking()
+        | rpp::ops::subscribe([&](int v) { values.push_back(v); }, [&] { is_completed = true; });
+
+    std::vector<int> expected(100);
+    std::iota(expected.begin(), expected.end(), 0);
+    CHECK(values == expected);
+    CHECK(is_completed);
+}
+
+TEST_CASE("observe_on emits items queued during draining")
+{
+    auto run_loop = rpp::schedulers::run_loop{};
+    auto subj     = rpp::subjects::publish_subject<int>{};
+
+    std::vector<int> values{};
+    subj.get_observable()
+        | rpp::ops::observe_on(run_loop)
+        | rpp::ops::subscribe([&](int v) {
+              values.push_back(v);
+              if (v < 3)
+              {
+                  subj.get_observer().on_next(v * 10);
+                  subj.get_observer().on_next(v + 1);
+              }
+          });
+
+    subj.get_observer().on_next(1);
+    while (!run_loop.is_empty())
+        run_loop.dispatch();
+
+    CHECK(values == std::vector{1, 10, 2, 20, 3});
+}
@@ -0,0 +1,185 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators.hpp>
+#include <rpp/schedulers.hpp>
+#include <rpp/sources.hpp>
+#include <rpp/subjects.hpp>
+
+#include "mock_observer.hpp"
+
+#include <type_traits>
+
+namespace
+{
+using rpp::details::observables::AtomicMode;
+using rpp::details::observables::default_disposable_strategy_selector;
+using rpp::details::observables::fixed_disposable_strategy_selector;
+
+using bool_strategy = rpp::details::observables::bool_disposable_strategy_selector;
+template<size_t Count>
+using fixed = fixed_disposable_strategy_selector<Count>;
+template<size_t Count>
+using atomic_fixed = fixed_disposable_strategy_selector<Count, AtomicMode::Atomic>;
+
+template<typename Observable>
+using strategy_of = typename std::decay_t<Observable>::expected_disposable_strategy;
+
+template<typename Expected, typename Observable>
+constexpr bool has_strategy = std::is_same_v<strategy_of<Observable>, Expected>;
+
+const auto source      = rpp::source::just(rpp::schedulers::immediate{}, 1);
+const auto subject     = rpp::subjects::publish_subject<int>{};
+const auto with_worker = rpp::source::just(rpp::schedulers::new_thread{}, 1);
+}
+
+TEST_CASE("sources declare expected disposable strategy")
+{
+    SECTION("just/empty/never/error have no disposables")
+    {
+        static_assert(has_strategy<bool_strategy, decltype(source)>);
+        static_assert(has_strategy<bool_strategy, decltype(rpp::source::empty<int>())>);
+        static_assert(has_strategy<bool_strategy, decltype(rpp::source::never<int>())>);
+        static_assert(has_strategy<bool_strategy, decltype(rpp::source::error<int>({}))>);
+    }
+
+    SECTION("just with disposable worker has 1 disposable")
+    {
+        static_assert(has_strategy<fixed<1>, decltype(with_worker)>);
+        static_assert(has_strategy<fixed<1>, decltype(rpp::source::interval(std::chrono::seconds{1}, rpp::schedulers::new_thread{}))>);
+    }
+
+    SECTION("subjects have 1 atomic disposable")
+    {
+        static_assert(has_strategy<atomic_fixed<1>, decltype(subject.get_observable())>);
+    }
+
+    SECTION("concat of known amount of observables sums disposables of all of them")
+    {
+        static_assert(has_strategy<bool_strategy, decltype(rpp::source::concat(source, source, source))>);
+        static_assert(has_strategy<fixed<3>, decltype(rpp::source::concat(with_worker, with_worker, with_worker))>);
+        static_assert(has_strategy<atomic_fixed<2>, decltype(rpp::source::concat(subject.get_observable(), subject.get_observable()))>);
+        static_assert(has_strategy<fixed<1>, decltype(rpp::source::concat(rpp::schedulers::new_thread{}, source, source))>);
+        static_assert(has_strategy<fixed<2>, decltype(rpp::source::concat<rpp::memory_model::use_shared>(with_worker, with_worker))>);
+    }
+
+    SECTION("concat of unknown amount of observables is fixed only for observables without disposables")
+    {
+        static_assert(has_strategy<bool_strategy, decltype(rpp::source::concat(std::vector{source, source}))>);
+        static_assert(has_strategy<default_disposable_strategy_selector, decltype(rpp::source::concat(std::vector{with_worker, with_worker}))>);
+        static_assert(has_strategy<bool_strategy, decltype(source | rpp::ops::repeat(10))>);
+        static_assert(has_strategy<default_disposable_strategy_selector, decltype(with_worker | rpp::ops::repeat(10))>);
+    }
+
+    SECTION("create and dynamic observables are unknown")
+    {
+        static_assert(has_strategy<default_disposable_strategy_selector, decltype(rpp::source::create<int>([](const auto&) {}))>);
+        static_assert(has_strategy<default_disposable_strategy_selector, decltype(source.as_dynamic())>);
+    }
+}
+
+TEST_CASE("operators declare expected disposable strategy")
+{
+    SECTION("forwarding operators keep strategy of source")
+    {
+        static_assert(has_strategy<fixed<1>, decltype(with_worker | rpp::ops::map([](int v) { return v; }))>);
+        static_assert(has_strategy<fixed<1>, decltype(with_worker | rpp::ops::filter([](int) { return true; }))>);
+        static_assert(has_strategy<fixed<1>, decltype(with_worker | rpp::ops::take(1))>);
+        static_assert(has_strategy<fixed<1>, decltype(with_worker | rpp::ops::skip(1))>);
+        static_assert(has_strategy<fixed<1>, decltype(with_worker | rpp::ops::scan([](int s, int v) { return s + v; }))>);
+        static_assert(has_strategy<fixed<1>, decltype(with_worker | rpp::ops::buffer(2))>);
+        static_assert(has_strategy<fixed<1>, decltype(with_worker | rpp::ops::distinct_until_changed())>);
+    }
+
+    SECTION("subscribe_on adds disposable of worker")
+    {
+        static_assert(has_strategy<fixed<2>, decltype(with_worker | rpp::ops::subscribe_on(rpp::schedulers::new_thread{}))>);
+        static_assert(has_strategy<bool_strategy, decltype(source | rpp::ops::subscribe_on(rpp::schedulers::immediate{}))>);
+    }
+
+    SECTION("operators with own disposable pass exactly 1 disposable")
+    {
+        static_assert(has_strategy<fixed<1>, decltype(source | rpp::ops::delay(std::chrono::seconds{1}, rpp::schedulers::new_thread{}))>);
+        static_assert(has_strategy<fixed<1>, decltype(source | rpp::ops::debounce(std::chrono::seconds{1}, rpp::schedulers::new_thread{}))>);
+        static_assert(has_strategy<fixed<1>, decltype(source | rpp::ops::observe_on(rpp::schedulers::new_thread{}))>);
+        static_assert(has_strategy<fixed<1>, decltype(source | rpp::ops::window(2))>);
+        static_assert(has_strategy<fixed<1>, decltype(source | rpp::ops::group_by([](int v) { return v; }))>);
+        static_assert(has_strategy<fixed<1>, decltype(source | rpp::ops::combine_latest(subject.get_observable()))>);
+        static_assert(has_strategy<fixed<1>, decltype(source | rpp::ops::with_latest_from(subject.get_observable()))>);
+        static_assert(has_strategy<fixed<1>, decltype(source | rpp::ops::take_until(subject.get_observable()))>);
+        static_assert(has_strategy<fixed<1>, decltype(rpp::source::just(source, source) | rpp::ops::switch_on_next())>);
+        static_assert(has_strategy<fixed<1>, decltype(rpp::source::just(source, source) | rpp::ops::merge())>);
+        static_assert(has_strategy<fixed<1>, decltype(source | rpp::ops::merge_with(subject.get_observable()))>);
+    }
+
+    SECTION("start_with is concat of known amount of observables")
+    {
+        static_assert(has_strategy<bool_strategy, decltype(source | rpp::ops::start_with(source))>);
+        static_assert(has_strategy<fixed<2>, decltype(with_worker | rpp::ops::start_with(with_worker))>);
+    }
+}
+
+TEST_CASE("combined disposable strategy")
+{
+    using rpp::details::observables::combined_disposable_strategy_t;
+
+    static_assert(std::is_same_v<combined_disposable_strategy_t<1>, bool_strategy>);
+    static_assert(std::is_same_v<combined_disposable_strategy_t<1, fixed<1>, bool_strategy, fixed<2>>, fixed<3>>);
+    static_assert(std::is_same_v<combined_disposable_strategy_t<3, fixed<2>>, fixed<6>>);
+    static_assert(std::is_same_v<combined_disposable_strategy_t<1, fixed<1>, atomic_fixed<1>>, atomic_fixed<2>>);
+    static_assert(std::is_same_v<combined_disposable_strategy_t<1, fixed<1>, default_disposable_strategy_selector>, default_disposable_strategy_selector>);
+    static_assert(std::is_same_v<combined_disposable_strategy_t<1, fixed<1>, rpp::details::observables::dynamic_disposable_strategy_selector<1>>, default_disposable_strategy_selector>);
+}
+
+TEST_CASE("operators with combined disposables work with exact amount of disposables")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    SECTION("concat of observables with disposables")
+    {
+        rpp::subjects::publish_subject<int> first{};
+        rpp::subjects::publish_subject<int> second{};
+
+        rpp::source::concat(first.get_observable(), second.get_observable()) | rpp::ops::subscribe(mock);
+
+        first.get_observer().on_next(1);
+        first.get_observer().on_completed();
+        second.get_observer().on_next(2);
+        second.get_observer().on_completed();
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_error_count() == 0);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("take_until/combine_latest/with_latest_from of observables with disposables")
+    {
+        rpp::subjects::publish_subject<int> first{};
+        rpp::subjects::publish_subject<int> second{};
+        rpp::subjects::publish_subject<int> third{};
+
+        first.get_observable()
+            | rpp::ops::combine_latest([](int a, int b) { return a + b; }, second.get_observable())
+            | rpp::ops::with_latest_from([](int a, int b) { return a * b; }, second.get_observable())
+            | rpp::ops::take_until(third.get_observable())
+            | rpp::ops::subscribe(mock);
+
+        second.get_observer().on_next(1);
+        first.get_observer().on_next(2);
+        third.get_observer().on_next(0);
+        first.get_observer().on_next(3);
+
+        CHECK(mock.get_received_values() == std::vector{3});
+        CHECK(mock.get_on_error_count() == 0);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
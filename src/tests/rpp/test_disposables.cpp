@@ -25,9 +25,14 @@ struct custom_disposable : public rpp::interface_disposable
 };
 }
 
-TEMPLATE_TEST_CASE("disposable keeps state", "", rpp::details::disposables::dynamic_disposables_container<0>, rpp::details::disposables::static_disposables_container<1>)
+TEMPLATE_TEST_CASE("disposable keeps state",
+                   "",
+                   rpp::composite_disposable_impl<rpp::details::disposables::dynamic_disposables_container<0>>,
+                   rpp::composite_disposable_impl<rpp::details::disposables::static_disposables_container<1>>,
+                   rpp::composite_disposable_impl<rpp::details::disposables::slot_map_disposables_container>,
+                   rpp::non_atomic_composite_disposable)
 {
-    auto d = rpp::composite_disposable_wrapper{std::make_shared<rpp::composite_disposable_impl<TestType>>()};
+    auto d = rpp::composite_disposable_wrapper{std::make_shared<TestType>()};
 
     CHECK(!d.is_disposed());
 
@@ -129,6 +134,44 @@ TEMPLATE_TEST_CASE("disposable keeps state", "", rpp::details::disposables::dyna
     }
 }
 
+TEST_CASE("disposable_wrapper handles strong and weak disposables")
+{
+    auto       original = std::make_shared<custom_disposable>();
+    const auto strong   = rpp::disposable_wrapper::from_shared(original);
+    const auto weak     = rpp::disposable_wrapper::from_weak(original);
+    const auto other    = rpp::disposable_wrapper::from_shared(std::make_shared<custom_disposable>());
+
+    CHECK(strong == weak);
+    CHECK(!(strong == other));
+    CHECK(!strong.is_disposed());
+    CHECK(!weak.is_disposed());
+    CHECK(strong.is_disposed_or_same_as(original.get()));
+    CHECK(weak.is_disposed_or_same_as(original.get()));
+    CHECK(!other.is_disposed_or_same_as(original.get()));
+    CHECK(rpp::disposable_wrapper{}.is_disposed());
+
+    SECTION("weak disposable is disposed once original is destroyed")
+    {
+        auto       temporary = std::make_shared<custom_disposable>();
+        const auto expired   = rpp::disposable_wrapper::from_weak(temporary);
+        CHECK(!expired.is_disposed());
+
+        temporary.reset();
+        CHECK(expired.is_disposed());
+        CHECK(expired.is_disposed_or_same_as(original.get()));
+        CHECK(!(expired == strong));
+    }
+
+    SECTION("disposing of weak disposable disposes original")
+    {
+        weak.dispose();
+        weak.dispose();
+        CHECK(original->dispose_count == 2);
+        CHECK(strong.is_disposed());
+        CHECK(weak.is_disposed());
+    }
+}
+
 TEST_CASE("refcount disposable dispose underlying in case of reaching zero")
 {
     auto refcount = std::make_shared<rpp::refcount_disposable>();
@@ -204,6 +247,127 @@ TEST_CASE("refcount disposable dispose underlying in case of reaching zero")
     }
 }
 
+TEST_CASE("refcount disposable disposes refs")
+{
+    auto refcount   = std::make_shared<rpp::refcount_disposable>();
+    auto underlying = std::make_shared<custom_disposable>();
+    refcount->get_underlying().add(underlying);
+
+    std::vector<rpp::composite_disposable_wrapper> refs{};
+    for (size_t i = 0; i < 3; ++i)
+        refs.push_back(refcount->add_ref());
+
+    SECTION("disposing of underlying disposes all refs")
+    {
+        refcount->get_underlying().dispose();
+
+        CHECK(underlying->dispose_count == 1);
+        for (const auto& ref : refs)
+            CHECK(ref.is_disposed());
+    }
+
+    SECTION("disposed refs free their slots for new refs")
+    {
+        refs[1].dispose();
+        for (size_t i = 0; i < 100; ++i)
+            refcount->add_ref().dispose();
+
+        auto new_ref = refcount->add_ref();
+        CHECK(!new_ref.is_disposed());
+
+        refs[0].dispose();
+        refs[2].dispose();
+        CHECK(underlying->dispose_count == 0);
+
+        SECTION("disposing of underlying disposes ref placed into reused slot")
+        {
+            refcount->get_underlying().dispose();
+            CHECK(new_ref.is_disposed());
+            CHECK(underlying->dispose_count == 1);
+        }
+        SECTION("disposing of last ref disposes underlying")
+        {
+            new_ref.dispose();
+            CHECK(underlying->dispose_count == 1);
+        }
+    }
+
+    SECTION("disposables added to ref are disposed with it")
+    {
+        auto inner = std::make_shared<custom_disposable>();
+        refs[0].add(inner);
+
+        refcount->get_underlying().dispose();
+        CHECK(inner->dispose_count == 1);
+    }
+}
+
+TEST_CASE("composite_disposable with slot_map container erases by handle")
+{
+    auto d = std::make_shared<rpp::composite_disposable_impl<rpp::details::disposables::slot_map_disposables_container>>();
+
+    std::vector<std::shared_ptr<custom_disposable>> others{};
+    std::vector<rpp::details::disposables::slot_map_disposables_container::handle> handles{};
+    for (size_t i = 0; i < 3; ++i)
+    {
+        others.push_back(std::make_shared<custom_disposable>());
+        const auto handle = d->insert(rpp::disposable_wrapper{others.back()});
+        REQUIRE(handle.has_value());
+        handles.push_back(handle.value());
+    }
+
+    SECTION("erased disposable is not disposed with composite")
+    {
+        d->erase(handles[1]);
+        CHECK(others[1].use_count() == 1);
+
+        d->dispose();
+        CHECK(others[0]->dispose_count == 1);
+        CHECK(others[1]->dispose_count == 0);
+        CHECK(others[2]->dispose_count == 1);
+    }
+
+    SECTION("slot of erased disposable is reused and stale handle is ignored")
+    {
+        d->erase(handles[0]);
+
+        auto       other  = std::make_shared<custom_disposable>();
+        const auto handle = d->insert(rpp::disposable_wrapper{other});
+        REQUIRE(handle.has_value());
+        CHECK(handle->index == handles[0].index);
+
+        d->erase(handles[0]);
+        d->dispose();
+        CHECK(other->dispose_count == 1);
+        CHECK(others[0]->dispose_count == 0);
+    }
+
+    SECTION("many inserts and erases keep only alive disposables")
+    {
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            auto other = std::make_shared<custom_disposable>();
+            d->erase(d->insert(rpp::disposable_wrapper{other}).value());
+            CHECK(other.use_count() == 1);
+        }
+
+        d->dispose();
+        for (const auto& other : others)
+            CHECK(other->dispose_count == 1);
+    }
+
+    SECTION("insert into disposed composite disposes disposable")
+    {
+        d->dispose();
+
+        auto other = std::make_shared<custom_disposable>();
+        CHECK(!d->insert(rpp::disposable_wrapper{other}).has_value());
+        CHECK(other->dispose_count == 1);
+
+        d->erase(handles[0]);
+    }
+}
+
 TEST_CASE("composite_disposable correctly handles exception")
 {
     auto d = rpp::composite_disposable_wrapper{std::make_shared<rpp::composite_disposable_impl<rpp::details::disposables::static_disposables_container<1>>>()};
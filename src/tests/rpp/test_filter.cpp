@@ -12,6 +12,7 @@
 
 #include <rpp/operators/filter.hpp>
 #include <rpp/sources/just.hpp>
+#include <rpp/schedulers/immediate.hpp>
 
 #include "mock_observer.hpp"
 #include "copy_count_tracker.hpp"
@@ -75,4 +76,22 @@ TEST_CASE("filter doesn't produce extra copies")
 TEST_CASE("filter satisfies disposable contracts")
 {
     test_operator_with_disposable<int>(rpp::ops::filter([](const int&){return false;}));
-}
\ No newline at end of file
+}
+
+TEST_CASE("filter keeps demand of backpressured observer")
+{
+    static_assert(rpp::constraint::requestable_observable<decltype(rpp::source::from_iterable_on_demand(std::vector{1}) | rpp::ops::filter([](int) { return true; }))>);
+    static_assert(!rpp::constraint::requestable_observable<decltype(rpp::source::just(1) | rpp::ops::filter([](int) { return true; }))>);
+
+    auto observer = requesting_mock_observer_strategy<int>{2};
+    rpp::source::from_iterable_on_demand(std::vector{1, 2, 3, 4, 5, 6, 7, 8}, rpp::schedulers::immediate{})
+        | rpp::ops::filter([](int v) { return v % 3 == 0; })
+        | rpp::ops::subscribe(observer.get_observer());
+
+    CHECK(observer.get_mock().get_received_values() == std::vector{3, 6});
+    CHECK(observer.get_mock().get_on_completed_count() == 0);
+
+    observer.request(1);
+    CHECK(observer.get_mock().get_received_values() == std::vector{3, 6});
+    CHECK(observer.get_mock().get_on_completed_count() == 1);
+}
@@ -18,6 +18,7 @@
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/never.hpp>
 #include <rpp/schedulers/immediate.hpp>
+#include <rpp/subjects/publish_subject.hpp>
 
 #include "copy_count_tracker.hpp"
 #include "mock_observer.hpp"
@@ -26,6 +27,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 TEMPLATE_TEST_CASE("flat_map", "", rpp::memory_model::use_stack, rpp::memory_model::use_shared)
 {
@@ -138,7 +140,49 @@ TEMPLATE_TEST_CASE("flat_map", "", rpp::memory_model::use_stack, rpp::memory_mod
     }
 }
 
+TEST_CASE("flat_map with max_concurrent")
+{
+    auto                                             mock = mock_observer_strategy<int>();
+    std::vector<rpp::subjects::publish_subject<int>> inners(3);
+
+    rpp::source::just(rpp::schedulers::immediate{}, 0, 1, 2)
+        | rpp::ops::flat_map([&](int i) { return inners[static_cast<size_t>(i)].get_observable(); }, 2)
+        | rpp::ops::subscribe(mock);
+
+    inners[2].get_observer().on_next(2);
+    inners[1].get_observer().on_next(1);
+    inners[0].get_observer().on_next(0);
+    SECTION("only first max_concurrent observables are subscribed")
+    {
+        CHECK(mock.get_received_values() == std::vector{1, 0});
+    }
+
+    SECTION("rest observables are subscribed once active ones complete")
+    {
+        inners[1].get_observer().on_completed();
+        inners[2].get_observer().on_next(2);
+        inners[0].get_observer().on_next(0);
+        CHECK(mock.get_received_values() == std::vector{1, 0, 2, 0});
+
+        inners[0].get_observer().on_completed();
+        inners[2].get_observer().on_completed();
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("flat_map with zero max_concurrent subscribes observables one by one")
+{
+    auto mock = mock_observer_strategy<int>();
+    rpp::source::just(rpp::schedulers::immediate{}, 0, 1, 2)
+        | rpp::ops::flat_map([](int i) { return rpp::source::just(i, i * 10).as_dynamic(); }, 0)
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_received_values() == std::vector{0, 0, 1, 10, 2, 20});
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
 TEST_CASE("flat_map satisfies disposable contracts")
 {
     test_operator_with_disposable<int>(rpp::ops::flat_map([](const auto& v){return rpp::source::just(v); }));
+    test_operator_with_disposable<int>(rpp::ops::flat_map([](const auto& v){return rpp::source::just(v); }, 2));
 }
\ No newline at end of file
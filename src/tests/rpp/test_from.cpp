@@ -394,4 +394,97 @@ TEMPLATE_TEST_CASE("just variadic",
             }
         }
     }
-}
\ No newline at end of file
+}
+
+namespace
+{
+struct request_one_by_one_state
+{
+    rpp::requestable_disposable_wrapper upstream{};
+    std::vector<int>                    values{};
+    size_t                              depth{};
+    size_t                              max_depth{};
+    bool                                completed{};
+};
+
+struct request_one_by_one_strategy
+{
+    std::shared_ptr<request_one_by_one_state> state;
+
+    void set_upstream(const rpp::disposable_wrapper& d) const
+    {
+        state->upstream = d.dynamic_cast_to<rpp::interface_requestable_disposable>();
+        state->upstream.request(1);
+    }
+
+    static bool is_disposed() { return false; }
+
+    void on_next(int v) const
+    {
+        state->values.push_back(v);
+        state->max_depth = std::max(state->max_depth, ++state->depth);
+        state->upstream.request(1);
+        --state->depth;
+    }
+
+    static void on_error(const std::exception_ptr&) {}
+
+    void on_completed() const { state->completed = true; }
+};
+} // namespace
+
+TEST_CASE("from_iterable_on_demand emits only requested items")
+{
+    const auto obs = rpp::source::from_iterable_on_demand(std::vector{1, 2, 3, 4, 5}, rpp::schedulers::immediate{});
+
+    SECTION("observer doesn't request anything - observable emits everything")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        obs.subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 5});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("observer requests 2 items during set_upstream")
+    {
+        auto observer = requesting_mock_observer_strategy<int>{2};
+        obs.subscribe(observer.get_observer());
+
+        CHECK(observer.is_backpressured());
+        CHECK(observer.get_mock().get_received_values() == std::vector{1, 2});
+        CHECK(observer.get_mock().get_on_completed_count() == 0);
+
+        SECTION("observer requests 2 more items")
+        {
+            observer.request(2);
+            CHECK(observer.get_mock().get_received_values() == std::vector{1, 2, 3, 4});
+            CHECK(observer.get_mock().get_on_completed_count() == 0);
+
+            SECTION("observer requests more than left")
+            {
+                observer.request(10);
+                CHECK(observer.get_mock().get_received_values() == std::vector{1, 2, 3, 4, 5});
+                CHECK(observer.get_mock().get_on_completed_count() == 1);
+            }
+        }
+    }
+
+    SECTION("observer requests 0 items - completion doesn't need demand")
+    {
+        auto observer = requesting_mock_observer_strategy<int>{0};
+        rpp::source::from_iterable_on_demand(std::vector<int>{}, rpp::schedulers::immediate{}).subscribe(observer.get_observer());
+
+        CHECK(observer.get_mock().get_received_values().empty());
+        CHECK(observer.get_mock().get_on_completed_count() == 1);
+    }
+
+    SECTION("observer requests next item from inside of on_next - no recursion")
+    {
+        auto state = std::make_shared<request_one_by_one_state>();
+        obs.subscribe(rpp::observer<int, request_one_by_one_strategy>{state});
+
+        CHECK(state->values == std::vector{1, 2, 3, 4, 5});
+        CHECK(state->max_depth == 1);
+        CHECK(state->completed);
+    }
+}
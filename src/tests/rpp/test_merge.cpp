@@ -12,12 +12,15 @@
 
 #include <rpp/operators/as_blocking.hpp>
 #include <rpp/operators/merge.hpp>
+#include <rpp/operators/take.hpp>
 #include <rpp/sources/create.hpp>
 #include <rpp/sources/just.hpp>
+#include <rpp/sources/empty.hpp>
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/never.hpp>
 #include <rpp/schedulers/immediate.hpp>
 #include <rpp/schedulers/new_thread.hpp>
+#include <rpp/subjects/publish_subject.hpp>
 #include <snitch/snitch_macros_check.hpp>
 
 #include "mock_observer.hpp"
@@ -25,8 +28,11 @@
 #include "disposable_observable.hpp"
 
 
+#include <atomic>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 TEMPLATE_TEST_CASE("merge for observable of observables", "", rpp::memory_model::use_stack, rpp::memory_model::use_shared)
 {
@@ -212,6 +218,185 @@ TEMPLATE_TEST_CASE("merge serializes emissions", "", rpp::memory_model::use_stac
     }
 }
 
+TEST_CASE("merge doesn't block emitters")
+{
+    SECTION("observer emits into merged source from inside of on_next")
+    {
+        rpp::subjects::publish_subject<int> subj{};
+        std::vector<int>                    values{};
+
+        subj.get_observable()
+            | rpp::ops::merge_with(rpp::source::never<int>())
+            | rpp::ops::subscribe([&](int v) {
+                  values.push_back(v);
+                  if (v == 1)
+                      subj.get_observer().on_next(2);
+                  // reentrant emission is delivered only after current one
+                  CHECK(values.back() == v);
+              });
+
+        subj.get_observer().on_next(1);
+        CHECK(values == std::vector{1, 2});
+    }
+
+    SECTION("many threads emit simultaneously")
+    {
+        constexpr size_t threads_count = 4;
+        constexpr int    values_count  = 1000;
+
+        std::vector<rpp::subjects::publish_subject<int>> subjects(threads_count);
+        std::atomic_bool                                 is_emitting{};
+        std::atomic_bool                                 was_overlap{};
+        size_t                                           count{};
+
+        subjects[0].get_observable()
+            | rpp::ops::merge_with(subjects[1].get_observable(), subjects[2].get_observable(), subjects[3].get_observable())
+            | rpp::ops::subscribe([&](int) {
+                  if (is_emitting.exchange(true))
+                      was_overlap = true;
+                  ++count;
+                  is_emitting = false;
+              });
+
+        std::vector<std::thread> threads{};
+        for (const auto& subj : subjects)
+            threads.emplace_back([subj] {
+                for (int v = 0; v < values_count; ++v)
+                    subj.get_observer().on_next(v);
+            });
+        for (auto& t : threads)
+            t.join();
+
+        CHECK(!was_overlap);
+        CHECK(count == threads_count * values_count);
+    }
+}
+
+TEST_CASE("merge of synchronous observables")
+{
+    static_assert(rpp::constraint::synchronous_observable<decltype(rpp::source::just(rpp::schedulers::immediate{}, 1))>);
+    static_assert(rpp::constraint::synchronous_observable<decltype(rpp::source::empty<int>())>);
+    static_assert(!rpp::constraint::synchronous_observable<decltype(rpp::source::just(1))>);
+    static_assert(!rpp::constraint::synchronous_observable<rpp::dynamic_observable<int>>);
+
+    auto mock = mock_observer_strategy<int>();
+
+    SECTION("merge_with emits values of observables one by one and completes once")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2)
+            | rpp::ops::merge_with(rpp::source::just(rpp::schedulers::immediate{}, 3), rpp::source::empty<int>())
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("error stops subscription to rest observables")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1)
+            | rpp::ops::merge_with(rpp::source::error<int>({}), rpp::source::just(rpp::schedulers::immediate{}, 3))
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1});
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(mock.get_on_completed_count() == 0);
+    }
+
+    SECTION("merge of observable of observables merged with another one")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, rpp::source::just(rpp::schedulers::immediate{}, 1), rpp::source::just(rpp::schedulers::immediate{}, 2))
+            | rpp::ops::merge_with(rpp::source::just(rpp::schedulers::immediate{}, rpp::source::just(rpp::schedulers::immediate{}, 3)))
+            | rpp::ops::merge()
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("disposed observer stops emissions")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2)
+            | rpp::ops::merge_with(rpp::source::just(rpp::schedulers::immediate{}, 3))
+            | rpp::ops::take(1)
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("merge with max_concurrent")
+{
+    auto                                                    mock = mock_observer_strategy<int>();
+    rpp::subjects::publish_subject<rpp::dynamic_observable<int>> source{};
+    std::vector<rpp::subjects::publish_subject<int>>        inners(3);
+
+    source.get_observable() | rpp::ops::merge(2) | rpp::ops::subscribe(mock);
+    for (const auto& inner : inners)
+        source.get_observer().on_next(inner.get_observable());
+
+    SECTION("only max_concurrent inner observables are subscribed")
+    {
+        inners[0].get_observer().on_next(1);
+        inners[1].get_observer().on_next(2);
+        inners[2].get_observer().on_next(3);
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+    }
+
+    SECTION("buffered observable is subscribed once active one completes")
+    {
+        inners[0].get_observer().on_completed();
+        inners[2].get_observer().on_next(3);
+        inners[1].get_observer().on_next(2);
+        CHECK(mock.get_received_values() == std::vector{3, 2});
+        CHECK(mock.get_on_completed_count() == 0);
+
+        SECTION("resulting observable completes after source and all inner observables")
+        {
+            inners[1].get_observer().on_completed();
+            inners[2].get_observer().on_completed();
+            CHECK(mock.get_on_completed_count() == 0);
+
+            source.get_observer().on_completed();
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+    }
+
+    SECTION("error from buffered observable is not delivered before its subscription")
+    {
+        inners[2].get_observer().on_error({});
+        CHECK(mock.get_on_error_count() == 0);
+    }
+
+    SECTION("many synchronous observables are buffered and subscribed one by one without recursion")
+    {
+        constexpr int count = 100000;
+        for (int v = 0; v < count; ++v)
+            source.get_observer().on_next(rpp::source::just(v).as_dynamic());
+
+        CHECK(mock.get_total_on_next_count() == 0);
+
+        // frees slot for inners[2] buffered before
+        inners[0].get_observer().on_completed();
+        CHECK(mock.get_total_on_next_count() == 0);
+
+        inners[1].get_observer().on_completed();
+        CHECK(mock.get_total_on_next_count() == count);
+        CHECK(mock.get_received_values().back() == count - 1);
+    }
+}
+
+TEST_CASE("merge with zero max_concurrent subscribes inner observables one by one")
+{
+    auto mock = mock_observer_strategy<int>();
+    rpp::source::just(rpp::source::just(1, 2).as_dynamic(), rpp::source::just(3).as_dynamic())
+        | rpp::ops::merge(0)
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
 TEMPLATE_TEST_CASE("merge handles race condition", "", rpp::memory_model::use_stack, rpp::memory_model::use_shared)
 {
     SECTION("source observable in current thread pairs with error in other thread")
@@ -268,6 +453,33 @@ TEST_CASE("merge dispose inner_disposable immediately")
     | rpp::ops::subscribe([](int){});
 }
 
+TEST_CASE("merge releases upstream of completed inner observables")
+{
+    auto disposable = std::make_shared<rpp::composite_disposable>();
+    auto inner      = rpp::source::create<int>([disposable](auto&& d) {
+        d.set_upstream(rpp::disposable_wrapper{disposable});
+        d.on_completed();
+    });
+
+    rpp::subjects::publish_subject<decltype(inner)> subj{};
+    auto                                            mock = mock_observer_strategy<int>{};
+
+    SECTION("merge")
+    {
+        subj.get_observable() | rpp::ops::merge() | rpp::ops::subscribe(mock);
+    }
+    SECTION("merge with max_concurrent")
+    {
+        subj.get_observable() | rpp::ops::merge(2) | rpp::ops::subscribe(mock);
+    }
+
+    for (size_t i = 0; i < 10; ++i)
+        subj.get_observer().on_next(inner);
+
+    CHECK(disposable.use_count() == 2); // local + captured by inner
+    CHECK(mock.get_on_completed_count() == 0);
+}
+
 TEST_CASE("merge doesn't produce extra copies")
 {
     SECTION("send value by copy")
@@ -298,4 +510,23 @@ TEST_CASE("merge satisfies disposable contracts")
         test_operator_with_disposable<int>(rpp::ops::merge_with(observable));
     }
     CHECK(observable_disposable->is_disposed() || observable_disposable.use_count() == 1);
-}
\ No newline at end of file
+}
+
+TEST_CASE("merge prefetches items of backpressured observables")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    const auto inner = [](int v) { return rpp::source::from_iterable_on_demand(std::vector<int>(300, v), rpp::schedulers::immediate{}); };
+
+    SECTION("merge_with")
+    {
+        inner(1) | rpp::ops::merge_with(inner(2)) | rpp::ops::subscribe(mock);
+    }
+    SECTION("merge with max_concurrent")
+    {
+        rpp::source::just(inner(1), inner(2)) | rpp::ops::merge(1) | rpp::ops::subscribe(mock);
+    }
+
+    CHECK(mock.get_total_on_next_count() == 600);
+    CHECK(mock.get_on_completed_count() == 1);
+}
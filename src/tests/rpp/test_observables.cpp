@@ -19,7 +19,9 @@
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/empty.hpp>
 #include <rpp/operators/as_blocking.hpp>
+#include <array>
 #include <chrono>
+#include <memory>
 #include <thread>
 
 TEST_CASE("create observable works properly as observable")
@@ -238,3 +240,50 @@ TEST_CASE("create observable works properly as observable")
         CHECK(pipe_operator_observer.get_on_completed_count() == pipe_function_observer.get_on_completed_count());
     }
 }
+
+TEST_CASE("dynamic observable keeps original observable")
+{
+    const auto check = [](auto&& observable, int expected) {
+        const auto dynamic = std::forward<decltype(observable)>(observable).as_dynamic();
+
+        // original, its copy and moved copy should behave the same
+        auto copy  = dynamic;
+        auto moved = std::move(copy);
+        for (const auto& obs : {dynamic, moved})
+        {
+            mock_observer_strategy<int> mock{};
+            obs.subscribe(mock);
+            CHECK(mock.get_received_values() == std::vector{expected});
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+    };
+
+    SECTION("small observable")
+    {
+        check(rpp::source::create<int>([v = 1](const auto& obs) {
+                  obs.on_next(v);
+                  obs.on_completed();
+              }),
+              1);
+    }
+
+    SECTION("big observable")
+    {
+        std::array<int, 64> values{};
+        values.back() = 2;
+        check(rpp::source::create<int>([values](const auto& obs) {
+                  obs.on_next(values.back());
+                  obs.on_completed();
+              }),
+              2);
+    }
+
+    SECTION("move-only observable")
+    {
+        check(rpp::source::create<int>([v = std::make_unique<int>(3)](const auto& obs) {
+                  obs.on_next(*v);
+                  obs.on_completed();
+              }),
+              3);
+    }
+}
@@ -0,0 +1,113 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/utils/ring_buffer.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+struct copy_throwing
+{
+    inline static int alive{};
+    inline static int copies_till_throw{-1};
+
+    explicit copy_throwing(int v)
+        : value{v}
+    {
+        ++alive;
+    }
+
+    copy_throwing(const copy_throwing& other)
+        : value{other.value}
+    {
+        if (copies_till_throw >= 0 && copies_till_throw-- == 0)
+            throw std::runtime_error{"copy"};
+        ++alive;
+    }
+
+    // not noexcept: ring_buffer has to copy values to keep original ones intact
+    copy_throwing(copy_throwing&& other)
+        : copy_throwing{static_cast<const copy_throwing&>(other)}
+    {
+    }
+
+    copy_throwing& operator=(const copy_throwing&) = delete;
+    copy_throwing& operator=(copy_throwing&&)      = delete;
+
+    ~copy_throwing() noexcept { --alive; }
+
+    int value;
+};
+
+std::vector<int> values_of(const rpp::utils::ring_buffer<copy_throwing>& buffer)
+{
+    std::vector<int> res{};
+    buffer.for_each([&](const copy_throwing& v) { res.push_back(v.value); });
+    return res;
+}
+} // namespace
+
+TEST_CASE("ring_buffer keeps values in FIFO order")
+{
+    rpp::utils::ring_buffer<int> buffer{};
+    for (int i = 0; i < 3; ++i)
+        buffer.push_back(i);
+    buffer.pop_front();
+    for (int i = 3; i < 10; ++i)
+        buffer.push_back(i);
+
+    CHECK(buffer.size() == 9);
+    CHECK(buffer.front() == 1);
+    CHECK(buffer.back() == 9);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        CHECK(buffer[i] == static_cast<int>(i) + 1);
+}
+
+TEST_CASE("ring_buffer is exception safe")
+{
+    copy_throwing::alive             = 0;
+    copy_throwing::copies_till_throw = -1;
+    {
+        rpp::utils::ring_buffer<copy_throwing> buffer{};
+        for (int i = 0; i < 4; ++i)
+            buffer.emplace_back(i);
+        buffer.pop_front();
+        buffer.emplace_back(4);
+        REQUIRE(buffer.size() == buffer.capacity());
+        REQUIRE(copy_throwing::alive == 4);
+
+        SECTION("throwing during growth keeps original values")
+        {
+            copy_throwing::copies_till_throw = 2;
+            CHECK_THROWS_AS(buffer.emplace_back(5), std::runtime_error);
+            copy_throwing::copies_till_throw = -1;
+
+            CHECK(copy_throwing::alive == 4);
+            CHECK(values_of(buffer) == std::vector{1, 2, 3, 4});
+
+            buffer.emplace_back(5);
+            CHECK(values_of(buffer) == std::vector{1, 2, 3, 4, 5});
+        }
+
+        SECTION("throwing during copy frees already copied values")
+        {
+            copy_throwing::copies_till_throw = 2;
+            CHECK_THROWS_AS(rpp::utils::ring_buffer<copy_throwing>{buffer}, std::runtime_error);
+            copy_throwing::copies_till_throw = -1;
+
+            CHECK(copy_throwing::alive == 4);
+            CHECK(values_of(buffer) == std::vector{1, 2, 3, 4});
+        }
+    }
+    CHECK(copy_throwing::alive == 0);
+}
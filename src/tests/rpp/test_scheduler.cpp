@@ -18,11 +18,16 @@
 #include <rpp/sources/just.hpp>
 #include <rpp/operators/as_blocking.hpp>
 #include <rpp/operators/subscribe_on.hpp>
+#include <rpp/operators/delay.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/sources/interval.hpp>
 
 #include "test_scheduler.hpp"
 
 #include <chrono>
 #include <future>
+#include <limits>
+#include <numeric>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -700,6 +705,28 @@ TEMPLATE_TEST_CASE("queue_based scheduler", "", rpp::schedulers::current_thread,
     }
 }
 
+TEST_CASE("current_thread releases memory captured by disposed schedulables before sleeping")
+{
+    const auto d              = std::make_shared<rpp::composite_disposable>();
+    const auto disposable_obs = mock_observer_strategy<int>{}.get_observer(d).as_dynamic();
+    const auto obs            = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    const auto worker         = rpp::schedulers::current_thread::create_worker();
+
+    std::weak_ptr<int>  weak{};
+    std::optional<bool> expired_on_timer{};
+    worker.schedule([&](const auto&) {
+        auto captured = std::make_shared<int>();
+        weak          = captured;
+        worker.schedule(std::chrono::milliseconds{10}, [&](const auto&) { expired_on_timer = weak.expired(); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        worker.schedule(std::chrono::hours{1}, [captured](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, disposable_obs);
+        d->dispose();
+        return rpp::schedulers::optional_delay_from_now{};
+    }, obs);
+
+    CHECK(expired_on_timer == true);
+    CHECK(weak.expired());
+}
+
 TEST_CASE("new_thread utilized current_thread")
 {
     std::atomic_bool inner_schedule_executed{};
@@ -740,6 +767,308 @@ TEST_CASE("new_thread works till end")
     CHECK(mock.get_received_values().size() == 10);
 }
 
+TEST_CASE("new_thread with timing_wheel executes delayed schedulables in order of timepoints")
+{
+    auto worker = rpp::schedulers::new_thread::create_worker(rpp::schedulers::timing_wheel{std::chrono::milliseconds{1}});
+    auto obs    = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int>   executions{};
+    std::promise<void> done{};
+    for (const int delay : {30, 10, 20, 10})
+    {
+        worker.schedule(std::chrono::milliseconds{delay}, [&, delay](const auto&) {
+            executions.push_back(delay);
+            if (executions.size() == 4)
+                done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        }, obs);
+    }
+
+    done.get_future().wait();
+    CHECK(executions == std::vector{10, 10, 20, 30});
+}
+
+TEST_CASE("new_thread keeps order of schedulables from each of concurrent producers")
+{
+    constexpr size_t producers_count = 4;
+    constexpr size_t count           = 1000;
+
+    auto worker = rpp::schedulers::new_thread::create_worker();
+    auto obs    = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<std::vector<size_t>> executions(producers_count);
+    std::atomic_size_t               executed{};
+
+    std::vector<std::thread> producers{};
+    for (size_t i = 0; i < producers_count; ++i)
+    {
+        producers.emplace_back([&, i] {
+            for (size_t j = 0; j < count; ++j)
+            {
+                worker.schedule([&, i, j](const auto&) {
+                    executions[i].push_back(j);
+                    ++executed;
+                    return rpp::schedulers::optional_delay_from_now{};
+                }, obs);
+            }
+        });
+    }
+    for (auto& t : producers)
+        t.join();
+
+    while (executed.load() != producers_count * count)
+        std::this_thread::yield();
+
+    std::vector<size_t> expected(count);
+    std::iota(expected.begin(), expected.end(), size_t{});
+    for (const auto& values : executions)
+        CHECK(values == expected);
+}
+
+TEST_CASE("thread_pool scheduler")
+{
+    auto d        = std::make_shared<rpp::composite_disposable>();
+    auto mock_obs = mock_observer_strategy<int>{};
+    auto obs      = mock_obs.get_observer(d).as_dynamic();
+
+    auto pool   = rpp::schedulers::thread_pool{2};
+    auto worker = pool.create_worker();
+    obs.set_upstream(worker.get_disposable());
+
+    std::promise<void> done{};
+    auto               done_future = done.get_future();
+
+    SECTION("thread_pool executes schedulable in another thread")
+    {
+        std::string thread_of_execution{};
+        worker.schedule([&](const auto&) {
+            thread_of_execution = get_thread_id_as_string();
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        }, obs);
+
+        done_future.wait();
+        CHECK(thread_of_execution != get_thread_id_as_string());
+    }
+
+    SECTION("thread_pool keeps order of schedulables of one worker")
+    {
+        std::vector<int> executions{};
+        for (int i = 0; i < 100; ++i)
+        {
+            worker.schedule([&, i](const auto&) {
+                executions.push_back(i);
+                if (i == 99)
+                    done.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            }, obs);
+        }
+
+        done_future.wait();
+        std::vector<int> expected(100);
+        std::iota(expected.begin(), expected.end(), 0);
+        CHECK(executions == expected);
+    }
+
+    SECTION("thread_pool respects to time point")
+    {
+        std::vector<int> executions{};
+        worker.schedule(std::chrono::milliseconds{3}, [&](const auto&) { executions.push_back(3); done.set_value(); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        worker.schedule(std::chrono::milliseconds{1}, [&](const auto&) { executions.push_back(1); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        worker.schedule(std::chrono::milliseconds{2}, [&](const auto&) { executions.push_back(2); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+
+        done_future.wait();
+        CHECK(executions == std::vector{1, 2, 3});
+    }
+
+    SECTION("thread_pool re-schedules schedulable with delay")
+    {
+        size_t call_count{};
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            if (++call_count <= 1)
+                return rpp::schedulers::optional_delay_from_now{std::chrono::milliseconds{1}};
+            done.set_value();
+            return std::nullopt;
+        }, obs);
+
+        done_future.wait();
+        CHECK(call_count == 2);
+    }
+
+    SECTION("thread_pool does not dispatch schedulable after disposing of disposable")
+    {
+        std::atomic_size_t call_count{};
+        worker.schedule(std::chrono::milliseconds{10}, [&](const auto&) { ++call_count; return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        d->dispose();
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+
+        CHECK(call_count == 0);
+    }
+
+    SECTION("thread_pool executes schedulables of many workers")
+    {
+        std::atomic_size_t call_count{};
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            pool.create_worker().schedule([&](const auto&) {
+                if (++call_count == 1000)
+                    done.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            }, obs);
+        }
+
+        done_future.wait();
+        CHECK(call_count == 1000);
+    }
+
+    SECTION("thread_pool utilizes current_thread")
+    {
+        std::vector<std::string> executions{};
+        worker.schedule([&](const auto& obs) {
+            rpp::schedulers::current_thread::create_worker().schedule([&](const auto&) {
+                executions.emplace_back("inner");
+                done.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            }, obs);
+            executions.emplace_back("outer");
+            return rpp::schedulers::optional_delay_from_now{};
+        }, obs);
+
+        done_future.wait();
+        CHECK(executions == std::vector<std::string>{"outer", "inner"});
+    }
+
+    SECTION("error during schedulable")
+    {
+        // observer without upstream to keep worker alive after error
+        const auto error_obs = mock_obs.get_observer().as_dynamic();
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now { throw std::runtime_error{"test"}; }, error_obs);
+        worker.schedule([&](const auto&) { done.set_value(); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+
+        done_future.wait();
+        CHECK(mock_obs.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("thread_pool works till end")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    rpp::source::just(1,2,3,4,5,6,7,8,9,10)
+    | rpp::operators::subscribe_on(rpp::schedulers::thread_pool{2})
+    | rpp::operators::as_blocking()
+    | rpp::operators::subscribe(mock);
+
+    CHECK(mock.get_received_values().size() == 10);
+}
+
+TEST_CASE("event_loop scheduler")
+{
+    auto mock_obs = mock_observer_strategy<int>{};
+    auto obs      = mock_obs.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::event_loop{2};
+
+    auto get_thread_of_worker = [&](const auto& worker) {
+        std::promise<std::string> thread{};
+        worker.schedule([&](const auto&) {
+            thread.set_value(get_thread_id_as_string());
+            return rpp::schedulers::optional_delay_from_now{};
+        }, obs);
+        return thread.get_future().get();
+    };
+
+    SECTION("workers are distributed among threads")
+    {
+        const auto worker_1 = scheduler.create_worker();
+        const auto worker_2 = scheduler.create_worker();
+
+        const auto thread_1 = get_thread_of_worker(worker_1);
+        const auto thread_2 = get_thread_of_worker(worker_2);
+
+        CHECK(thread_1 != thread_2);
+        CHECK(thread_1 != get_thread_id_as_string());
+        CHECK(thread_2 != get_thread_id_as_string());
+
+        SECTION("worker keeps its thread")
+        {
+            CHECK(get_thread_of_worker(worker_1) == thread_1);
+            CHECK(get_thread_of_worker(worker_2) == thread_2);
+        }
+
+        SECTION("new worker re-uses existing threads")
+        {
+            const auto thread_3 = get_thread_of_worker(scheduler.create_worker());
+            CHECK((thread_3 == thread_1 || thread_3 == thread_2));
+        }
+    }
+
+    SECTION("event_loop keeps order of schedulables of one worker")
+    {
+        const auto       worker = scheduler.create_worker();
+        std::vector<int> executions{};
+        for (int i = 0; i < 100; ++i)
+        {
+            worker.schedule([&executions, i](const auto&) {
+                executions.push_back(i);
+                return rpp::schedulers::optional_delay_from_now{};
+            }, obs);
+        }
+        get_thread_of_worker(worker);
+
+        std::vector<int> expected(100);
+        std::iota(expected.begin(), expected.end(), 0);
+        CHECK(executions == expected);
+    }
+
+    SECTION("disposing of worker cancels only its schedulables")
+    {
+        const auto worker_1 = scheduler.create_worker();
+        const auto worker_2 = scheduler.create_worker();
+
+        std::atomic_size_t call_count{};
+        worker_1.schedule(std::chrono::milliseconds{10}, [&](const auto&) { ++call_count; return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        worker_2.schedule(std::chrono::milliseconds{10}, [&](const auto&) { ++call_count; return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        worker_1.get_disposable().dispose();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        CHECK(call_count == 1);
+        CHECK(!worker_2.get_disposable().is_disposed());
+    }
+
+    SECTION("disposing of worker releases memory captured by its schedulables eagerly")
+    {
+        const auto worker = scheduler.create_worker();
+
+        auto captured = std::make_shared<int>();
+        worker.schedule(std::chrono::hours{1}, [captured](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        worker.schedule(std::chrono::milliseconds{1}, [captured](const auto&) { return rpp::schedulers::optional_delay_from_now{std::chrono::hours{1}}; }, obs);
+        std::weak_ptr<int> weak = std::exchange(captured, nullptr);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        CHECK(!weak.expired());
+
+        worker.get_disposable().dispose();
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (!weak.expired() && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        CHECK(weak.expired());
+    }
+}
+
+TEST_CASE("event_loop works till end")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    rpp::source::just(1,2,3,4,5,6,7,8,9,10)
+    | rpp::operators::subscribe_on(rpp::schedulers::event_loop{2})
+    | rpp::operators::as_blocking()
+    | rpp::operators::subscribe(mock);
+
+    CHECK(mock.get_received_values().size() == 10);
+}
+
 TEST_CASE("run_loop scheduler dispatches tasks only manually")
 {
 
@@ -869,6 +1198,156 @@ TEST_CASE("run_loop scheduler dispatches tasks only manually")
     }
 }
 
+TEST_CASE("virtual_time scheduler executes schedulables only on advancing of time")
+{
+    const auto start = rpp::schedulers::time_point{std::chrono::hours{1}};
+    auto scheduler = rpp::schedulers::virtual_time{start};
+    auto worker = scheduler.create_worker();
+    auto d = std::make_shared<rpp::composite_disposable>();
+    auto obs = mock_observer_strategy<int>{}.get_observer(d).as_dynamic();
+
+    std::vector<rpp::schedulers::time_point> executions{};
+    const auto schedule = [&](rpp::schedulers::duration delay) {
+        worker.schedule(delay, [&](const auto&) -> rpp::schedulers::optional_delay_from_now { executions.push_back(worker.now()); return {}; }, obs);
+    };
+
+    CHECK(scheduler.now() == start);
+    CHECK(worker.now() == start);
+
+    schedule(std::chrono::seconds{2});
+    schedule(std::chrono::seconds{1});
+    schedule(std::chrono::hours{10});
+
+    SECTION("nothing executed without advancing")
+    {
+        CHECK(executions.empty());
+        CHECK(!scheduler.is_empty());
+    }
+
+    SECTION("advance_by executes only due schedulables at their timepoints")
+    {
+        scheduler.advance_by(std::chrono::seconds{2});
+        CHECK(executions == std::vector{start + std::chrono::seconds{1}, start + std::chrono::seconds{2}});
+        CHECK(scheduler.now() == start + std::chrono::seconds{2});
+    }
+
+    SECTION("advance_to never moves clock backwards")
+    {
+        scheduler.advance_to(start + std::chrono::seconds{1});
+        scheduler.advance_to(start);
+        CHECK(executions == std::vector{start + std::chrono::seconds{1}});
+        CHECK(scheduler.now() == start + std::chrono::seconds{1});
+    }
+
+    SECTION("run_all executes everything")
+    {
+        scheduler.run_all();
+        CHECK(executions.size() == 3);
+        CHECK(scheduler.now() == start + std::chrono::hours{10});
+        CHECK(scheduler.is_empty());
+    }
+
+    SECTION("schedulables of disposed handler are dropped")
+    {
+        d->dispose();
+        scheduler.run_all();
+        CHECK(executions.empty());
+        CHECK(scheduler.now() == start);
+    }
+
+    SECTION("interval + delay are replayed without real waiting")
+    {
+        mock_observer_strategy<size_t> mock{};
+        const auto real_start = std::chrono::steady_clock::now();
+
+        rpp::source::interval(std::chrono::minutes{1}, scheduler)
+            | rpp::operators::take(60)
+            | rpp::operators::delay(std::chrono::seconds{30}, scheduler)
+            | rpp::operators::subscribe(mock);
+
+        scheduler.advance_by(std::chrono::hours{1});
+        CHECK(mock.get_received_values().size() == 59);
+        CHECK(mock.get_on_completed_count() == 0);
+
+        scheduler.run_all();
+        CHECK(mock.get_received_values().size() == 60);
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(std::chrono::steady_clock::now() - real_start < std::chrono::minutes{1});
+    }
+}
+
+TEST_CASE("clocks")
+{
+    SECTION("cached clock returns same time_point during batch")
+    {
+        using clock = rpp::schedulers::clocks::cached<>;
+
+        const auto before = clock::now();
+        {
+            const clock::batch_scope scope{};
+            const auto               cached = clock::now();
+            CHECK(cached >= before);
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            CHECK(clock::now() == cached);
+
+            {
+                const clock::batch_scope nested{};
+                CHECK(clock::now() > cached);
+            }
+            CHECK(clock::now() > cached);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        CHECK(clock::now() > before + std::chrono::milliseconds{1});
+    }
+
+    SECTION("tsc clock follows steady clock and never goes backwards")
+    {
+        using clock = rpp::schedulers::clocks::tsc;
+
+        constexpr auto tolerance = std::chrono::milliseconds{2};
+        auto           last      = clock::now();
+        for (size_t i = 0; i < 10; ++i)
+        {
+            std::this_thread::sleep_for(clock::calibration_period / 4);
+            for (size_t j = 0; j < 1000; ++j)
+            {
+                const auto now = clock::now();
+                CHECK(now >= last);
+                last = now;
+            }
+
+            const auto before = rpp::schedulers::clock_type::now();
+            const auto now    = clock::now();
+            const auto after  = rpp::schedulers::clock_type::now();
+            CHECK(now >= before - tolerance);
+            CHECK(now <= after + tolerance);
+            last = std::max(last, now);
+        }
+    }
+
+#if RPP_HAS_TSC
+    SECTION("tsc reading outside of anchored period is not converted to time_point")
+    {
+        using rpp::schedulers::details::tsc_anchor;
+        using rpp::schedulers::details::tsc_to_time_point;
+
+        const auto       origin = rpp::schedulers::clock_type::now();
+        const auto       period = std::chrono::milliseconds{10};
+        const tsc_anchor anchor{1'000'000, origin, 0.5};
+
+        CHECK(tsc_to_time_point(anchor, 1'000'000, period) == origin);
+        CHECK(tsc_to_time_point(anchor, 1'000'200, period) == origin + std::chrono::nanoseconds{100});
+        // TSC of another core is behind
+        CHECK(!tsc_to_time_point(anchor, 999'999, period).has_value());
+        CHECK(!tsc_to_time_point(anchor, 0, period).has_value());
+        // too far ahead
+        CHECK(!tsc_to_time_point(anchor, 1'000'000 + 20'000'000, period).has_value());
+        CHECK(!tsc_to_time_point(anchor, std::numeric_limits<uint64_t>::max(), period).has_value());
+    }
+#endif
+}
+
 TEST_CASE("different delaying strategies")
 {
     test_scheduler scheduler{};
@@ -905,4 +1384,252 @@ TEST_CASE("different delaying strategies")
         CHECK(scheduler.get_schedulings() == std::vector{now, now + delay});
         CHECK(scheduler.get_executions() == std::vector{now});
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("schedulables_queue keeps order by time_point and insertion")
+{
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::new_thread::worker_strategy> queue{};
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int> executions{};
+    const auto now = rpp::schedulers::time_point{};
+
+    auto emplace = [&](std::chrono::nanoseconds delay, int id)
+    {
+        queue.emplace(now + delay, [&executions](const auto&, int id) {
+            executions.push_back(id);
+            return rpp::schedulers::optional_delay_from_now{};
+        }, obs, id);
+    };
+
+    auto drain = [&]
+    {
+        while (!queue.is_empty())
+            (*queue.pop())();
+    };
+
+    SECTION("monotonic timepoints")
+    {
+        for (int i = 0; i < 5; ++i)
+            emplace(std::chrono::nanoseconds{i}, i);
+
+        CHECK(queue.size() == 5);
+        drain();
+        CHECK(executions == std::vector{0, 1, 2, 3, 4});
+    }
+
+    SECTION("same timepoints")
+    {
+        for (int i = 0; i < 5; ++i)
+            emplace(std::chrono::nanoseconds{}, i);
+
+        drain();
+        CHECK(executions == std::vector{0, 1, 2, 3, 4});
+    }
+
+    SECTION("out of order timepoints")
+    {
+        emplace(std::chrono::nanoseconds{5}, 0);
+        emplace(std::chrono::nanoseconds{1}, 1);
+        emplace(std::chrono::nanoseconds{3}, 2);
+        emplace(std::chrono::nanoseconds{1}, 3);
+        emplace(std::chrono::nanoseconds{5}, 4);
+        emplace(std::chrono::nanoseconds{2}, 5);
+        emplace(std::chrono::nanoseconds{6}, 6);
+        emplace(std::chrono::nanoseconds{0}, 7);
+
+        drain();
+        CHECK(executions == std::vector{7, 1, 3, 5, 2, 0, 4, 6});
+    }
+
+    SECTION("re-emplaced schedulable goes after already scheduled with same timepoint")
+    {
+        emplace(std::chrono::nanoseconds{1}, 0);
+        emplace(std::chrono::nanoseconds{2}, 1);
+
+        auto top = queue.pop();
+        queue.emplace(now + std::chrono::nanoseconds{2}, std::move(top));
+
+        drain();
+        CHECK(executions == std::vector{1, 0});
+    }
+}
+
+TEST_CASE("schedulables_queue reuses memory of destroyed schedulables via pool")
+{
+    rpp::schedulers::details::schedulables_pool pool{};
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::new_thread::worker_strategy> queue{pool};
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto emplace = [&]
+    {
+        queue.emplace(rpp::schedulers::time_point{}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    };
+
+    emplace();
+    const auto* first = queue.pop().get();
+
+    SECTION("same size schedulable re-uses same memory")
+    {
+        emplace();
+        CHECK(queue.pop().get() == first);
+    }
+
+    SECTION("schedulable destroyed in another thread returns memory to pool")
+    {
+        emplace();
+        std::thread{[top = queue.pop()] {}}.join();
+
+        emplace();
+        CHECK(queue.pop().get() == first);
+    }
+}
+
+TEST_CASE("schedulables_queue with timing_wheel keeps same order as with binary heap")
+{
+    rpp::schedulers::details::schedulables_pool pool{};
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::new_thread::worker_strategy> heap_queue{pool};
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::new_thread::worker_strategy> wheel_queue{pool, rpp::schedulers::timing_wheel{std::chrono::milliseconds{1}}};
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    const auto now = rpp::schedulers::new_thread::worker_strategy::now();
+
+    auto get_order = [&](auto& queue, const std::vector<std::chrono::nanoseconds>& delays)
+    {
+        std::vector<size_t> executions{};
+        for (size_t i = 0; i < delays.size(); ++i)
+        {
+            queue.emplace(now + delays[i], [&executions](const auto&, size_t id) {
+                executions.push_back(id);
+                return rpp::schedulers::optional_delay_from_now{};
+            }, obs, i);
+        }
+        CHECK(queue.size() == delays.size());
+
+        while (!queue.is_empty())
+            (*queue.pop())();
+        return executions;
+    };
+
+    SECTION("timepoints inside of one tick, across levels and far away from each other")
+    {
+        std::vector<std::chrono::nanoseconds> delays{};
+        for (size_t i = 0; i < 5000; ++i)
+        {
+            const auto spread = std::array<std::chrono::nanoseconds, 4>{std::chrono::microseconds{100}, std::chrono::milliseconds{50}, std::chrono::seconds{10}, std::chrono::hours{10}}[i % 4];
+            delays.push_back(std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>((i * 7919) % 1000)} * (spread.count() / 1000));
+        }
+
+        CHECK(get_order(wheel_queue, delays) == get_order(heap_queue, delays));
+    }
+
+    SECTION("timepoints in the past")
+    {
+        const std::vector<std::chrono::nanoseconds> delays{std::chrono::milliseconds{5}, -std::chrono::milliseconds{5}, std::chrono::milliseconds{3}, -std::chrono::seconds{1}, std::chrono::milliseconds{3}};
+
+        CHECK(get_order(wheel_queue, delays) == std::vector<size_t>{3, 1, 2, 4, 0});
+    }
+}
+
+TEST_CASE("schedulables_queue erases disposed schedulables eagerly")
+{
+    rpp::schedulers::details::schedulables_pool pool{};
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::new_thread::worker_strategy> queue{pool, rpp::schedulers::timing_wheel{std::chrono::milliseconds{1}}};
+
+    auto d              = std::make_shared<rpp::composite_disposable>();
+    auto disposable_obs = mock_observer_strategy<int>{}.get_observer(d).as_dynamic();
+    auto obs            = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int> executions{};
+    const auto       now     = rpp::schedulers::new_thread::worker_strategy::now();
+    auto             emplace = [&](std::chrono::nanoseconds delay, int id, const auto& handler) {
+        queue.emplace(now + delay, [&executions](const auto&, int id) {
+            executions.push_back(id);
+            return rpp::schedulers::optional_delay_from_now{};
+        }, handler, id);
+    };
+
+    // fifo lane
+    emplace(std::chrono::seconds{1}, 0, disposable_obs);
+    emplace(std::chrono::seconds{2}, 1, obs);
+    emplace(std::chrono::seconds{3}, 2, disposable_obs);
+    // timing wheel
+    emplace(std::chrono::milliseconds{500}, 3, disposable_obs);
+    emplace(std::chrono::milliseconds{600}, 4, obs);
+    // binary heap
+    emplace(-std::chrono::seconds{1}, 5, disposable_obs);
+    emplace(-std::chrono::seconds{2}, 6, obs);
+
+    d->dispose();
+    queue.erase_disposed();
+    CHECK(queue.size() == 3);
+
+    while (!queue.is_empty())
+        (*queue.pop())();
+    CHECK(executions == std::vector{6, 4, 1});
+
+    emplace(std::chrono::seconds{1}, 7, obs);
+    (*queue.pop())();
+    CHECK(executions == std::vector{6, 4, 1, 7});
+}
+
+TEST_CASE("timing_wheel_storage")
+{
+    using node_t = rpp::schedulers::details::schedulable_base;
+    rpp::schedulers::details::timing_wheel_storage<node_t> wheel{rpp::schedulers::timing_wheel{std::chrono::milliseconds{1}}};
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto make_node = [&](std::chrono::milliseconds delay)
+    {
+        return rpp::schedulers::details::make_schedulable<rpp::schedulers::new_thread::worker_strategy>(nullptr, rpp::schedulers::time_point{delay}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs).release();
+    };
+
+    auto pop_all = [&]
+    {
+        std::vector<rpp::schedulers::time_point> res{};
+        while (!wheel.is_empty())
+        {
+            wheel.advance([&](node_t* node) {
+                res.push_back(node->get_timepoint());
+                delete node;
+            });
+        }
+        return res;
+    };
+
+    SECTION("node due in terms of wheel is not inserted")
+    {
+        wheel.reset(rpp::schedulers::time_point{std::chrono::milliseconds{10}});
+        auto* node = make_node(std::chrono::milliseconds{10});
+        CHECK(!wheel.insert(node));
+        CHECK(wheel.is_empty());
+        delete node;
+    }
+
+    SECTION("nodes are handed out in order of ticks")
+    {
+        for (const auto delay : {70, 5, 5000, 64, 1, 300000, 4096})
+            CHECK(wheel.insert(make_node(std::chrono::milliseconds{delay})));
+        CHECK(wheel.size() == 7);
+        CHECK(wheel.lower_bound() <= rpp::schedulers::time_point{std::chrono::milliseconds{1}});
+
+        const auto res = pop_all();
+        CHECK(std::is_sorted(res.begin(), res.end()));
+        CHECK(res.size() == 7);
+    }
+
+    SECTION("erased node is not handed out")
+    {
+        wheel.insert(make_node(std::chrono::milliseconds{1}));
+        auto* node = make_node(std::chrono::milliseconds{2});
+        wheel.insert(node);
+        wheel.insert(make_node(std::chrono::milliseconds{2}));
+        wheel.insert(make_node(std::chrono::milliseconds{3}));
+
+        wheel.erase(node);
+        delete node;
+
+        CHECK(wheel.size() == 3);
+        CHECK(pop_all() == std::vector{rpp::schedulers::time_point{std::chrono::milliseconds{1}}, rpp::schedulers::time_point{std::chrono::milliseconds{2}}, rpp::schedulers::time_point{std::chrono::milliseconds{3}}});
+    }
+}
@@ -10,18 +10,30 @@
 
 #include <snitch/snitch.hpp>
 
+#include <rpp/subjects/async_subject.hpp>
+#include <rpp/subjects/behavior_subject.hpp>
 #include <rpp/subjects/publish_subject.hpp>
+#include <rpp/subjects/replay_subject.hpp>
+#include <rpp/subjects/serialized_subject.hpp>
 
+#include "copy_count_tracker.hpp"
 #include "mock_observer.hpp"
 #include <rpp/disposables/composite_disposable.hpp>
 
-TEST_CASE("publish subject multicasts values")
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <optional>
+#include <thread>
+
+TEMPLATE_TEST_CASE("publish subject multicasts values", "", rpp::subjects::publish_subject<int>, rpp::subjects::serialized_subject<int>, rpp::subjects::single_threaded_subject<int>)
 {
     auto mock_1 = mock_observer_strategy<int>{};
     auto mock_2 = mock_observer_strategy<int>{};
     SECTION("publish subject")
     {
-        auto sub = rpp::subjects::publish_subject<int>{};
+        auto sub = TestType{};
         SECTION("subscribe multiple observers")
         {
             auto dis_1 = std::make_shared<rpp::composite_disposable>();
@@ -129,12 +141,12 @@ TEST_CASE("publish subject multicasts values")
     }
 }
 
-TEST_CASE("publish subject caches error/completed")
+TEMPLATE_TEST_CASE("publish subject caches error/completed", "", rpp::subjects::publish_subject<int>, rpp::subjects::serialized_subject<int>, rpp::subjects::single_threaded_subject<int>)
 {
     auto mock = mock_observer_strategy<int>{};
     SECTION("publish subject")
     {
-        auto subj = rpp::subjects::publish_subject<int>{};
+        auto subj = TestType{};
         SECTION("emit value")
         {
             subj.get_observer().on_next(1);
@@ -223,4 +235,519 @@ TEST_CASE("publish subject caches error/completed")
             }
         }
     }
-}
\ No newline at end of file
+}
+TEMPLATE_TEST_CASE("publish subject handles churn of observers", "", rpp::subjects::publish_subject<int>, rpp::subjects::serialized_subject<int>, rpp::subjects::single_threaded_subject<int>)
+{
+    auto subj = TestType{};
+
+    std::vector<mock_observer_strategy<int>>                 mocks(100);
+    std::vector<std::shared_ptr<rpp::composite_disposable>> disposables{};
+    for (const auto& mock : mocks)
+    {
+        disposables.push_back(std::make_shared<rpp::composite_disposable>());
+        subj.get_observable().subscribe(mock.get_observer(disposables.back()));
+    }
+
+    SECTION("dispose most of observers and emit value")
+    {
+        for (size_t i = 0; i < mocks.size(); ++i)
+        {
+            if (i % 10 != 0)
+                disposables[i]->dispose();
+        }
+        subj.get_observer().on_next(1);
+
+        SECTION("only alive observers obtain value")
+        {
+            for (size_t i = 0; i < mocks.size(); ++i)
+                CHECK(mocks[i].get_received_values() == (i % 10 == 0 ? std::vector{1} : std::vector<int>{}));
+        }
+
+        SECTION("subscribe new observer and emit value")
+        {
+            auto mock = mock_observer_strategy<int>{};
+            subj.get_observable().subscribe(mock);
+            subj.get_observer().on_next(2);
+
+            CHECK(mock.get_received_values() == std::vector{2});
+            CHECK(mocks[0].get_received_values() == std::vector{1, 2});
+            CHECK(mocks[1].get_received_values() == std::vector<int>{});
+        }
+    }
+
+    SECTION("observers subscribe and unsubscribe during emission")
+    {
+        auto inner_mock = mock_observer_strategy<int>{};
+        subj.get_observable().subscribe([&](int v) {
+            if (v == 1)
+            {
+                for (const auto& d : disposables)
+                    d->dispose();
+                subj.get_observable().subscribe(inner_mock);
+            }
+        });
+
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(2);
+        subj.get_observer().on_completed();
+
+        CHECK(mocks.front().get_received_values() == std::vector{1});
+        CHECK(inner_mock.get_received_values() == std::vector{2});
+        CHECK(inner_mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("publish subject handles concurrent emissions during churn of observers")
+{
+    auto subj = rpp::subjects::publish_subject<int>{};
+
+    std::atomic<size_t> count{};
+    subj.get_observable().subscribe([&](int) { ++count; });
+
+    std::atomic_bool is_done{};
+    std::thread      churn{[&] {
+        // every subscribe or dispose of batch forces replacement of block with observers
+        std::vector<rpp::composite_disposable_wrapper> disposables{};
+        while (!is_done)
+        {
+            for (size_t i = 0; i < 16; ++i)
+                disposables.push_back(subj.get_observable().subscribe_with_disposable([](int) {}));
+            for (const auto& d : disposables)
+                d.dispose();
+            disposables.clear();
+        }
+    }};
+
+    std::vector<std::thread> emitters{};
+    for (size_t i = 0; i < 2; ++i)
+        emitters.emplace_back([&] {
+            for (int v = 0; v < 10000; ++v)
+                subj.get_observer().on_next(v);
+        });
+    for (auto& t : emitters)
+        t.join();
+
+    is_done = true;
+    churn.join();
+
+    CHECK(count == 20000);
+}
+
+TEST_CASE("publish subject destroys disposed observers without further subscriptions")
+{
+    auto subj = rpp::subjects::publish_subject<int>{};
+
+    std::promise<void> entered{};
+    std::promise<void> release{};
+    subj.get_observable().subscribe([&, release_future = release.get_future().share()](int) {
+        entered.set_value();
+        release_future.wait();
+    });
+
+    auto                     tracker    = std::make_shared<int>();
+    const std::weak_ptr<int> weak       = tracker;
+    const auto               disposable = subj.get_observable().subscribe_with_disposable([tracker](int) {});
+    tracker.reset();
+
+    auto emission = std::async(std::launch::async, [&] { subj.get_observer().on_next(1); });
+    entered.get_future().wait();
+
+    // emission is still iterating over block with disposed observer
+    disposable.dispose();
+    CHECK(!weak.expired());
+
+    release.set_value();
+    emission.get();
+    CHECK(weak.expired());
+}
+
+TEST_CASE("serialized subject serializes emissions from multiple threads")
+{
+    auto subj = rpp::subjects::serialized_subject<int>{};
+
+    std::atomic_bool is_emitting{};
+    std::atomic_bool was_overlap{};
+    size_t           count{};
+    subj.get_observable().subscribe([&](int) {
+        if (is_emitting.exchange(true))
+            was_overlap = true;
+        std::this_thread::yield();
+        ++count;
+        is_emitting = false;
+    });
+
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < 4; ++i)
+        threads.emplace_back([&] {
+            for (int v = 0; v < 1000; ++v)
+                subj.get_observer().on_next(v);
+        });
+    for (auto& t : threads)
+        t.join();
+
+    CHECK(!was_overlap);
+    CHECK(count == 4000);
+}
+
+TEST_CASE("behavior subject emits latest value to new observers")
+{
+    auto subj = rpp::subjects::behavior_subject<int>{10};
+    auto mock_1 = mock_observer_strategy<int>{};
+    subj.get_observable().subscribe(mock_1);
+
+    SECTION("observer obtains initial value")
+    {
+        CHECK(mock_1.get_received_values() == std::vector{10});
+    }
+
+    SECTION("emit values and subscribe another observer")
+    {
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(2);
+
+        auto mock_2 = mock_observer_strategy<int>{};
+        subj.get_observable().subscribe(mock_2);
+        subj.get_observer().on_next(3);
+
+        CHECK(mock_1.get_received_values() == std::vector{10, 1, 2, 3});
+        CHECK(mock_2.get_received_values() == std::vector{2, 3});
+    }
+
+    SECTION("complete and subscribe another observer")
+    {
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_completed();
+
+        auto mock_2 = mock_observer_strategy<int>{};
+        subj.get_observable().subscribe(mock_2);
+
+        CHECK(mock_2.get_received_values() == std::vector<int>{});
+        CHECK(mock_2.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("replay subject emits history to new observers")
+{
+    SECTION("unbounded replay subject")
+    {
+        auto subj = rpp::subjects::replay_subject<int>{};
+        for (int i = 0; i < 100; ++i)
+            subj.get_observer().on_next(i);
+
+        auto mock = mock_observer_strategy<int>{};
+        subj.get_observable().subscribe(mock);
+        subj.get_observer().on_next(100);
+
+        CHECK(mock.get_received_values().size() == 101);
+        CHECK(mock.get_received_values().front() == 0);
+        CHECK(mock.get_received_values().back() == 100);
+    }
+
+    SECTION("replay subject bounded by count keeps only last values")
+    {
+        auto subj = rpp::subjects::replay_subject<int>{size_t{3}};
+        for (int i = 0; i < 10; ++i)
+            subj.get_observer().on_next(i);
+
+        auto mock = mock_observer_strategy<int>{};
+        subj.get_observable().subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{7, 8, 9});
+
+        SECTION("history and completion are replayed after completion")
+        {
+            subj.get_observer().on_completed();
+            subj.get_observer().on_next(10);
+
+            auto late_mock = mock_observer_strategy<int>{};
+            subj.get_observable().subscribe(late_mock);
+            CHECK(late_mock.get_received_values() == std::vector{7, 8, 9});
+            CHECK(late_mock.get_on_completed_count() == 1);
+        }
+    }
+
+    SECTION("replay subject bounded by time drops expired values")
+    {
+        auto subj = rpp::subjects::replay_subject<int>{std::numeric_limits<size_t>::max(), std::chrono::milliseconds{50}};
+        subj.get_observer().on_next(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        subj.get_observer().on_next(2);
+
+        auto mock = mock_observer_strategy<int>{};
+        subj.get_observable().subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{2});
+    }
+
+    SECTION("replay subject bounded by count keeps last values spread over several chunks")
+    {
+        auto subj = rpp::subjects::replay_subject<int>{size_t{100}};
+        for (int i = 0; i < 1000; ++i)
+            subj.get_observer().on_next(i);
+
+        auto mock = mock_observer_strategy<int>{};
+        subj.get_observable().subscribe(mock);
+
+        std::vector<int> expected(100);
+        std::iota(expected.begin(), expected.end(), 900);
+        CHECK(mock.get_received_values() == expected);
+    }
+
+    SECTION("history is replayed without copying")
+    {
+        auto subj    = rpp::subjects::replay_subject<copy_count_tracker>{};
+        auto tracker = copy_count_tracker{};
+        for (int i = 0; i < 3; ++i)
+            subj.get_observer().on_next(tracker);
+
+        const auto copies = tracker.get_copy_count();
+        size_t     count{};
+        subj.get_observable().subscribe([&](const copy_count_tracker&) { ++count; });
+
+        CHECK(count == 3);
+        CHECK(tracker.get_copy_count() == copies);
+    }
+
+    SECTION("snapshot of history is kept while observer modifies history during replaying")
+    {
+        auto subj = rpp::subjects::replay_subject<int>{size_t{2}};
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(2);
+
+        std::vector<int> values{};
+        subj.get_observable().subscribe([&](int v) {
+            values.push_back(v);
+            if (v == 1)
+            {
+                for (int i = 3; i < 6; ++i)
+                    subj.get_observer().on_next(i);
+            }
+        });
+
+        CHECK(values == std::vector{1, 2, 3, 4, 5});
+
+        auto mock = mock_observer_strategy<int>{};
+        subj.get_observable().subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{4, 5});
+    }
+}
+
+TEST_CASE("async subject emits only last value on completion")
+{
+    auto subj = rpp::subjects::async_subject<int>{};
+    auto mock_1 = mock_observer_strategy<int>{};
+    subj.get_observable().subscribe(mock_1);
+
+    subj.get_observer().on_next(1);
+    subj.get_observer().on_next(2);
+    CHECK(mock_1.get_received_values() == std::vector<int>{});
+
+    SECTION("complete")
+    {
+        subj.get_observer().on_completed();
+        CHECK(mock_1.get_received_values() == std::vector{2});
+        CHECK(mock_1.get_on_completed_count() == 1);
+
+        SECTION("late observer obtains same value and completion")
+        {
+            auto mock_2 = mock_observer_strategy<int>{};
+            subj.get_observable().subscribe(mock_2);
+            CHECK(mock_2.get_received_values() == std::vector{2});
+            CHECK(mock_2.get_on_completed_count() == 1);
+        }
+    }
+
+    SECTION("error")
+    {
+        subj.get_observer().on_error(std::make_exception_ptr(std::runtime_error{""}));
+        CHECK(mock_1.get_received_values() == std::vector<int>{});
+        CHECK(mock_1.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("subjects with cached values don't lose values emitted during subscription")
+{
+    std::vector<int>  values{};
+    std::future<void> emission{};
+
+    // emits from another thread right in the middle of subscription: while cached value is being delivered to new observer
+    const auto subscribe_and_emit_concurrently = [&](const auto& subj) {
+        subj.get_observable().subscribe([&](int v) {
+            values.push_back(v);
+            if (v != 0)
+                return;
+
+            emission = std::async(std::launch::async, [&] { subj.get_observer().on_next(1); });
+            // emission happens right in the middle of replaying of cached value
+            emission.wait_for(std::chrono::milliseconds{100});
+        });
+        emission.get();
+    };
+
+    SECTION("behavior subject")
+    {
+        subscribe_and_emit_concurrently(rpp::subjects::behavior_subject<int>{0});
+        CHECK(values == std::vector{0, 1});
+    }
+
+    SECTION("replay subject")
+    {
+        auto subj = rpp::subjects::replay_subject<int>{};
+        subj.get_observer().on_next(0);
+
+        subscribe_and_emit_concurrently(subj);
+        CHECK(values == std::vector{0, 1});
+    }
+
+    SECTION("async subject")
+    {
+        for (size_t i = 0; i < 200; ++i)
+        {
+            auto subj = rpp::subjects::async_subject<int>{};
+            auto mock = mock_observer_strategy<int>{};
+
+            std::thread emitter{[&] {
+                subj.get_observer().on_next(1);
+                subj.get_observer().on_completed();
+            }};
+            subj.get_observable().subscribe(mock);
+            emitter.join();
+
+            CHECK(mock.get_received_values() == std::vector{1});
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+    }
+}
+
+TEST_CASE("replay subject replays history without gaps and duplicates during concurrent emissions")
+{
+    auto subj = rpp::subjects::replay_subject<int>{};
+
+    constexpr int                 count = 1000;
+    std::vector<std::vector<int>> received(50);
+
+    std::thread emitter{[&] {
+        for (int v = 0; v < count; ++v)
+            subj.get_observer().on_next(v);
+        subj.get_observer().on_completed();
+    }};
+    for (auto& values : received)
+        subj.get_observable().subscribe([&values](int v) { values.push_back(v); });
+    emitter.join();
+
+    std::vector<int> expected(count);
+    std::iota(expected.begin(), expected.end(), 0);
+    for (const auto& values : received)
+        CHECK(values == expected);
+}
+
+TEST_CASE("bounded replay subject replays history without gaps during concurrent emissions")
+{
+    // small bound forces reusing of chunks while they can be replayed to some observers
+    auto subj = rpp::subjects::replay_subject<int>{size_t{8}};
+
+    constexpr int                 count = 10000;
+    std::vector<std::vector<int>> received(200);
+
+    std::thread emitter{[&] {
+        for (int v = 0; v < count; ++v)
+            subj.get_observer().on_next(v);
+        subj.get_observer().on_completed();
+    }};
+    for (auto& values : received)
+        subj.get_observable().subscribe([&values](int v) { values.push_back(v); });
+    emitter.join();
+
+    for (const auto& values : received)
+    {
+        REQUIRE(!values.empty());
+        CHECK(values.back() == count - 1);
+        CHECK(static_cast<int>(values.size()) == values.back() - values.front() + 1);
+        CHECK(std::is_sorted(values.cbegin(), values.cend()));
+    }
+}
+
+TEST_CASE("behavior subject emits latest value without gaps and duplicates during concurrent emissions")
+{
+    auto subj = rpp::subjects::behavior_subject<int>{-1};
+
+    constexpr int                 count = 10000;
+    std::vector<std::vector<int>> received(200);
+
+    std::thread emitter{[&] {
+        for (int v = 0; v < count; ++v)
+            subj.get_observer().on_next(v);
+    }};
+    for (auto& values : received)
+        subj.get_observable().subscribe([&values](int v) { values.push_back(v); });
+    emitter.join();
+
+    for (const auto& values : received)
+    {
+        REQUIRE(!values.empty());
+        CHECK(values.back() == count - 1);
+        CHECK(static_cast<int>(values.size()) == values.back() - values.front() + 1);
+        CHECK(std::is_sorted(values.cbegin(), values.cend()));
+    }
+}
+
+TEST_CASE("subjects with cached values don't call observers under lock")
+{
+    // observer waits for another thread using the same subject: it is the same as waiting for user's lock held by thread subscribing to subject
+    // such a lock cycle is deadlock in case of calling of observers under lock
+    const auto check_subscription_from_observer = [](const auto& subj, bool live) {
+        std::future<void>   subscription{};
+        std::optional<bool> is_ready{};
+        subj.get_observable().subscribe([&](int v) {
+            if ((v == 1) != live || subscription.valid())
+                return;
+
+            subscription = std::async(std::launch::async, [&] { subj.get_observable().subscribe([](int) {}); });
+            is_ready     = subscription.wait_for(std::chrono::seconds{1}) == std::future_status::ready;
+        });
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_completed();
+
+        subscription.get();
+        CHECK(is_ready == true);
+    };
+
+    SECTION("behavior subject")
+    {
+        SECTION("during replaying")
+        {
+            check_subscription_from_observer(rpp::subjects::behavior_subject<int>{0}, false);
+        }
+        SECTION("during emission")
+        {
+            check_subscription_from_observer(rpp::subjects::behavior_subject<int>{0}, true);
+        }
+    }
+
+    SECTION("replay subject")
+    {
+        SECTION("during replaying")
+        {
+            auto subj = rpp::subjects::replay_subject<int>{};
+            subj.get_observer().on_next(0);
+            check_subscription_from_observer(subj, false);
+        }
+        SECTION("during emission")
+        {
+            check_subscription_from_observer(rpp::subjects::replay_subject<int>{}, true);
+        }
+    }
+
+    SECTION("async subject")
+    {
+        SECTION("during replaying")
+        {
+            auto subj = rpp::subjects::async_subject<int>{};
+            subj.get_observer().on_next(0);
+            subj.get_observer().on_completed();
+            check_subscription_from_observer(subj, false);
+        }
+        SECTION("during emission")
+        {
+            check_subscription_from_observer(rpp::subjects::async_subject<int>{}, true);
+        }
+    }
+}
@@ -11,8 +11,11 @@
 #pragma once
 
 #include "rpp/disposables/fwd.hpp"
+#include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/observers/observer.hpp>
 
+#include <memory>
+
 #include <vector>
 
 template<typename Type>
@@ -69,3 +72,38 @@ private:
 
     std::shared_ptr<State> m_state{};
 };
+
+/**
+ * @brief Same as mock_observer_strategy, but enables backpressure of upstream by requesting `initial_request` items during set_upstream
+ */
+template<typename Type>
+class requesting_mock_observer_strategy final
+{
+public:
+    explicit requesting_mock_observer_strategy(size_t initial_request)
+        : m_initial_request{initial_request} {}
+
+    void on_next(const Type& v) const noexcept { m_mock.on_next(v); }
+    void on_next(Type&& v) const noexcept { m_mock.on_next(std::move(v)); }
+    void on_error(const std::exception_ptr& err) const noexcept { m_mock.on_error(err); }
+    void on_completed() const noexcept { m_mock.on_completed(); }
+
+    static bool is_disposed() noexcept { return false; }
+    void set_upstream(const rpp::disposable_wrapper& d) const noexcept
+    {
+        *m_upstream = d.dynamic_cast_to<rpp::interface_requestable_disposable>();
+        m_upstream->request(m_initial_request);
+    }
+
+    void request(size_t count) const { m_upstream->request(count); }
+    bool is_backpressured() const { return m_upstream->has_underlying(); }
+
+    const mock_observer_strategy<Type>& get_mock() const { return m_mock; }
+
+    auto get_observer() const {return rpp::observer<Type, requesting_mock_observer_strategy<Type>>{*this}; }
+
+private:
+    mock_observer_strategy<Type>                         m_mock{};
+    size_t                                               m_initial_request;
+    std::shared_ptr<rpp::requestable_disposable_wrapper> m_upstream = std::make_shared<rpp::requestable_disposable_wrapper>();
+};
@@ -41,8 +41,7 @@ public:
                 if (time_point > s_current_time)
                     return;
 
-                auto fn = queue.top();
-                queue.pop();
+                auto fn = queue.pop();
 
                 executions.push_back(s_current_time);
                 if (auto new_timepoint = (*fn)()) 